@@ -7,7 +7,11 @@
  * @date March, 2020
  */
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <string>
 
 // Uses cxxopts from https://github.com/jarro2783/cxxopts under the MIT license
@@ -16,6 +20,12 @@
 #include "grid.h"
 #include "world.h"
 #include "zoo.h"
+#include "rule.h"
+#include "census.h"
+#include "soup.h"
+#include "predecessor.h"
+#include "frame_ring.h"
+#include "world_server.h"
 
 int main(int argc, char *argv[]) {
 
@@ -29,6 +39,19 @@ int main(int argc, char *argv[]) {
             ("s,steps","The number of steps to simulate the world.", cxxopts::value<int>()->default_value("10"))
             ("e,every","Print world to the console every N steps. 0 disables printing.", cxxopts::value<int>()->default_value("0"))
             ("t,toroidal", "Simulate the Game of Life on a torus.", cxxopts::value<bool>()->default_value("false"))
+            ("topology", "How the edges are joined: plane, torus, cylinder-horizontal, cylinder-vertical, klein-bottle, cross-surface or boundary-alive.", cxxopts::value<std::string>()->default_value("plane"))
+            ("r,rule", "The Life-like rule to simulate in B/S or Hensel notation, e.g. B36/S23 or B2-a/S12.", cxxopts::value<std::string>()->default_value("B3/S23"))
+            ("soup-search", "Run a search of N random soups until they settle and save the census to the output path, or census.txt.", cxxopts::value<long long>())
+            ("seed", "The seed of the soup search.", cxxopts::value<std::uint64_t>()->default_value("1"))
+            ("symmetry", "The symmetry of each soup in the soup search: C1, C2, C4, D2, D4 or D8.", cxxopts::value<std::string>()->default_value("C1"))
+            ("soup-size", "The width and height of each soup in the soup search.", cxxopts::value<int>()->default_value("16"))
+            ("predecessor", "Search for a pattern that steps to the loaded one and save it to the output path.", cxxopts::value<bool>()->default_value("false"))
+            ("threads", "The number of threads for stepping and for the soup and predecessor searches. 0 uses every core.", cxxopts::value<int>()->default_value("0"))
+            ("huge-pages", "Back large worlds with transparent huge pages when stepping with several threads.", cxxopts::value<bool>()->default_value("false"))
+            ("publish", "Publish the world's frames to viewers through the named shared memory ring, e.g. /life_frames.", cxxopts::value<std::string>())
+            ("publish-every", "Publish every N generations to the shared memory ring.", cxxopts::value<int>()->default_value("1"))
+            ("serve", "Host worlds for clients over the Unix domain socket at the path, answering on --threads threads, until killed.", cxxopts::value<std::string>())
+            ("serve-files", "The directory clients of --serve may load ascii files from. Loading is refused without it.", cxxopts::value<std::string>()->default_value(""))
             ("h,help", "Print usage.");
 
     // Actually parse the command line arguments
@@ -45,6 +68,80 @@ int main(int argc, char *argv[]) {
     const int  every    = result["every"].as<int>();
     const bool toroidal = result["toroidal"].as<bool>();
 
+    // Look up the topology, a torus if the toroidal flag was given
+    const std::map<std::string, Topology> topologies = {
+            {"plane", Topology::PLANE},
+            {"torus", Topology::TORUS},
+            {"cylinder-horizontal", Topology::CYLINDER_HORIZONTAL},
+            {"cylinder-vertical", Topology::CYLINDER_VERTICAL},
+            {"klein-bottle", Topology::KLEIN_BOTTLE},
+            {"cross-surface", Topology::CROSS_SURFACE},
+            {"boundary-alive", Topology::BOUNDARY_ALIVE}};
+    if (!topologies.count(result["topology"].as<std::string>())) {
+        std::cerr << "unknown topology " << result["topology"].as<std::string>() << std::endl;
+        std::exit(-1);
+    }
+    const Topology topology = toroidal ? Topology::TORUS : topologies.at(result["topology"].as<std::string>());
+
+    // Host worlds for clients instead of simulating one if asked to
+    if (result.count("serve")) {
+        try {
+            WorldServer server(result["serve"].as<std::string>(), result["threads"].as<int>(),
+                               result["serve-files"].as<std::string>());
+            std::cout << "Serving worlds on " << result["serve"].as<std::string>() << " with "
+                      << server.get_threads() << " threads" << std::endl;
+            server.serve();
+        }
+        catch (const std::exception &ex) {
+            std::cerr << ex.what() << std::endl;
+            std::exit(-1);
+        }
+        return 0;
+    }
+
+    // Run a soup search instead of a single world if asked to
+    if (result.count("soup-search")) {
+        try {
+            Soup::Settings settings;
+            settings.soups = result["soup-search"].as<long long>();
+            settings.seed = result["seed"].as<std::uint64_t>();
+            settings.size = result["soup-size"].as<int>();
+            settings.world = std::max(64, 4 * settings.size);
+            settings.threads = result["threads"].as<int>();
+            settings.rule = Rule(result["rule"].as<std::string>());
+
+            // Look up the symmetry of the soups
+            const std::map<std::string, Soup::Symmetry> symmetries = {
+                    {"C1", Soup::Symmetry::C1},
+                    {"C2", Soup::Symmetry::C2},
+                    {"C4", Soup::Symmetry::C4},
+                    {"D2", Soup::Symmetry::D2},
+                    {"D4", Soup::Symmetry::D4},
+                    {"D8", Soup::Symmetry::D8}};
+            if (!symmetries.count(result["symmetry"].as<std::string>())) {
+                std::cerr << "unknown symmetry " << result["symmetry"].as<std::string>() << std::endl;
+                std::exit(-1);
+            }
+            settings.symmetry = symmetries.at(result["symmetry"].as<std::string>());
+
+            // Print the number of soups done and the rate over the top of the last line
+            Soup::Report report = Soup::search(settings, Census::Table(), [&](long long soups, double seconds) {
+                std::cout << "\rSoups " << soups << " of " << settings.soups << " | "
+                          << static_cast<long long>(soups / std::max(seconds, 1e-9)) << " soups/sec" << std::flush;
+            });
+            std::cout << std::endl;
+
+            const std::string path = result.count("output") ? result["output"].as<std::string>() : "census.txt";
+            Soup::save_report(path, settings, report);
+            std::cout << report.finds.size() << " kinds of object found, census saved to " << path << std::endl;
+        }
+        catch (const std::exception &ex) {
+            std::cerr << ex.what() << std::endl;
+            std::exit(-1);
+        }
+        return 0;
+    }
+
     // Start with an empty grid
     Grid grid;
 
@@ -59,8 +156,55 @@ int main(int argc, char *argv[]) {
         }
     }
 
+    // Search for a parent of the loaded pattern instead of simulating it if asked to
+    if (result["predecessor"].as<bool>()) {
+        try {
+            Predecessor::Settings settings;
+            settings.threads = result["threads"].as<int>();
+            settings.rule = Rule(result["rule"].as<std::string>());
+
+            // Print the number of cells tried and the rate over the top of the last line
+            Predecessor::Result parent = Predecessor::search(grid, settings, [](long long nodes, double seconds) {
+                std::cout << "\rCells tried " << nodes << " | "
+                          << static_cast<long long>(nodes / std::max(seconds, 1e-9)) << " cells/sec" << std::flush;
+            });
+            std::cout << std::endl << "Searched " << parent.branches << " branches in " << parent.seconds << " seconds" << std::endl;
+
+            if (!parent.found) {
+                std::cout << "No predecessor exists, the pattern is an orphan" << std::endl;
+                return 0;
+            }
+            std::cout << "Predecessor found..." << std::endl << parent.parent << std::endl;
+            if (result.count("output")) {
+                Zoo::save_ascii(result["output"].as<std::string>(), parent.parent);
+            }
+        }
+        catch (const std::exception &ex) {
+            std::cerr << ex.what() << std::endl;
+            std::exit(-1);
+        }
+        return 0;
+    }
+
     // Construct a world from the parsed grid
     World world(grid);
+    std::unique_ptr<FramePublisher> publisher;
+
+    // Attempt to parse the rule to simulate, and to set up the stepping threads and frame publishing if asked to
+    try {
+        world.set_rule(Rule(result["rule"].as<std::string>()));
+        if (result.count("threads")) {
+            world.set_threads(result["threads"].as<int>(), true, result["huge-pages"].as<bool>());
+        }
+        if (result.count("publish")) {
+            publisher.reset(new FramePublisher(result["publish"].as<std::string>(), world.get_width(), world.get_height()));
+            world.set_publisher(publisher.get(), result["publish-every"].as<int>());
+        }
+    }
+    catch (const std::exception &ex) {
+        std::cerr << ex.what() << std::endl;
+        std::exit(-1);
+    }
 
     // Print the initial state of the grid
     std::cout << "Initial state..." << std::endl
@@ -69,7 +213,7 @@ int main(int argc, char *argv[]) {
 
     // Perform the requested number of update steps
     for (int step = 0; step < steps; step++) {
-        world.step(toroidal);
+        world.step(topology);
 
         // Print the state of the grid every N steps
         if ((every > 0) && (step % every == 0)) {
@@ -0,0 +1,170 @@
+/**
+ * Implements the BandPool class, a fixed set of threads that a World hands the bands of each step to.
+ *      - Starting a thread and pinning it to a cpu costs far more than handing it work, so a world with several
+ *        threads keeps a pool of them from World::set_threads() on rather than starting new ones every step.
+ *
+ *      - The pool has one thread per band, and band b is always run by the same thread.
+ *          - Each thread pins itself to its band's cpu once, when it starts, so the cells a band's thread first
+ *            wrote stay local to the cpu that steps them.
+ *          - A round of work wakes every thread, and the calling thread waits until the last one is done.
+ *          - The first exception thrown by a band is passed on to the caller once every band has finished.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "band_pool.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <pthread.h>
+#include <sched.h>
+
+/**
+ * pin_thread(cpu)
+ *
+ * Helper to pin the calling thread to a cpu. Failing to pin is not an error, the thread just runs unpinned.
+ */
+static void pin_thread(int cpu){
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/**
+ * BandPool::BandPool(bands, cpus)
+ *
+ * Construct a pool with a thread for each band, which waits for work.
+ *
+ * @example
+ *
+ *      // Keep four threads pinned to the first four cpus, and have each print its band
+ *      BandPool pool(4, {0, 1, 2, 3});
+ *      pool.run([](int band){ std::cout << band << std::endl; });
+ *
+ * @param bands
+ *      The number of bands, and of threads.
+ *
+ * @param cpus
+ *      The cpu to pin each band's thread to, or empty to leave the threads unpinned.
+ */
+BandPool::BandPool(int bands, const std::vector<int>& cpus){
+    this->work = nullptr;
+    this->round = 0;
+    this->running = 0;
+    this->stopping = false;
+    for(int band = 0; band < bands; band++){
+        int cpu = (band < int(cpus.size())) ? cpus[band] : -1;
+        workers.emplace_back([this, band, cpu](){
+            run_worker(band, cpu);
+        });
+    }
+}
+
+/**
+ * BandPool::~BandPool()
+ *
+ * Stop every thread of the pool and wait for them to end.
+ */
+BandPool::~BandPool(){
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    started.notify_all();
+    for(std::thread& worker : workers){
+        worker.join();
+    }
+}
+
+/**
+ * BandPool::get_bands()
+ *
+ * Gets the number of bands, and of threads, of the pool.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of bands.
+ */
+int BandPool::get_bands() const{
+    return int(workers.size());
+}
+
+/**
+ * BandPool::run(band_work)
+ *
+ * Run band_work(band) for every band, each on its band's thread, and wait for them all to finish. Only one thread
+ * may run work on a pool at a time.
+ *
+ * @param band_work
+ *      The work to do for each band, given the band's index.
+ *
+ * @throws
+ *      Whatever the first band to fail threw, once every band has finished.
+ */
+void BandPool::run(const std::function<void(int)>& band_work){
+    std::unique_lock<std::mutex> lock(mutex);
+    work = &band_work;
+    running = int(workers.size());
+    error = nullptr;
+    round++;
+    started.notify_all();
+    finished.wait(lock, [this](){
+        return running == 0;
+    });
+    work = nullptr;
+
+    //exception
+    if(error){
+        std::exception_ptr thrown = error;
+        error = nullptr;
+        std::rethrow_exception(thrown);
+    }
+}
+
+/**
+ * BandPool::run_worker(band, cpu)
+ *
+ * Private helper function run by each band's thread, which pins itself and then runs its band of every round until
+ * the pool is stopped.
+ *
+ * @param band
+ *      The band the thread runs.
+ *
+ * @param cpu
+ *      The cpu to pin the thread to, or -1 to leave it unpinned.
+ */
+void BandPool::run_worker(int band, int cpu){
+    if(cpu >= 0){
+        pin_thread(cpu);
+    }
+    long long seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while(true){
+        started.wait(lock, [&](){
+            return stopping || round != seen;
+        });
+        if(stopping){
+            return;
+        }
+        seen = round;
+        const std::function<void(int)>* current = work;
+        lock.unlock();
+
+        std::exception_ptr thrown;
+        try{
+            (*current)(band);
+        }catch(...){
+            thrown = std::current_exception();
+        }
+
+        lock.lock();
+        if(thrown && !error){
+            error = thrown;
+        }
+        running--;
+        if(running == 0){
+            finished.notify_one();
+        }
+    }
+}
@@ -0,0 +1,45 @@
+/**
+ * Declares the BandPool class, a fixed set of threads that a World hands the bands of each step to.
+ * Rich documentation for the api and behaviour the class can be found in band_pool.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Declare the structure of the BandPool class, which keeps one thread per band, each pinned to its own cpu if it was
+ * given one, and runs a piece of work on every band at once, waiting for all of them to finish.
+ */
+class BandPool {
+    private:
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable started;
+        std::condition_variable finished;
+        const std::function<void(int)>* work;
+        long long round;
+        int running;
+        bool stopping;
+        std::exception_ptr error;
+
+        void run_worker(int band, int cpu);
+
+    public:
+        BandPool(int bands, const std::vector<int>& cpus);
+        ~BandPool();
+        BandPool(const BandPool&) = delete;
+        BandPool& operator=(const BandPool&) = delete;
+
+        int get_bands() const;
+        void run(const std::function<void(int)>& band_work);
+};
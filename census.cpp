@@ -0,0 +1,462 @@
+/**
+ * Implements a Census namespace with methods for counting the objects left on a Grid after a run.
+ *      - Objects are groups of alive cells where each cell is within a small radius of another in the group.
+ *          - The default radius of 2 joins cells with at most one dead cell between them, which keeps objects such
+ *            as the light weight spaceship, whose cells are not all connected in every phase, in one piece.
+ *            A radius of 1 makes objects the connected groups of alive cells.
+ *
+ *      - Objects are compared in a canonical form, so the same object matches in any position or orientation.
+ *          - The canonical form is the object cropped to its bounding box, in whichever of its eight
+ *            Grid::rotate / Grid::reflect orientations has the smallest Grid::hash.
+ *
+ *      - A Table names the objects a census can recognise.
+ *          - Tables start out knowing the creatures in the Zoo, in every phase they pass through.
+ *          - More objects can be added directly or loaded from ascii .gol files.
+ *          - Unrecognised objects are still counted, under a name generated from their population and hash.
+ *
+ *      - Objects are found by labelling connected runs of alive cells with a union-find.
+ *          - Runs are found, joined and measured in parallel bands of rows, joining with lock-free
+ *            compare-and-swap so threads never wait on each other.
+ *          - Each distinct object shape is only put into canonical form once, however many copies there are.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "census.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include "world.h"
+#include "zoo.h"
+#include "grid_arena.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace {
+
+/**
+ * A Run is a horizontal line of alive cells spanning [x0, x1) on row y.
+ */
+struct Run {
+    int x0;
+    int x1;
+    int y;
+};
+
+}
+
+/**
+ * find_root(parent, i)
+ *
+ * Helper to follow the union-find links from a run up to the root of its group.
+ */
+static int find_root(std::vector<std::atomic<int>>& parent, int i){
+    int next = parent[i].load();
+    while(next != i){
+        i = next;
+        next = parent[i].load();
+    }
+    return i;
+}
+
+/**
+ * join_runs(parent, a, b)
+ *
+ * Helper to merge the groups of two runs. The larger root is always linked under the smaller,
+ * and the link only succeeds if the root is still a root, so concurrent joins never lose a group.
+ */
+static void join_runs(std::vector<std::atomic<int>>& parent, int a, int b){
+    while(true){
+        a = find_root(parent, a);
+        b = find_root(parent, b);
+        if(a == b){
+            return;
+        }
+        if(a < b){
+            std::swap(a, b);
+        }
+        int expected = a;
+        if(parent[a].compare_exchange_strong(expected, b)){
+            return;
+        }
+    }
+}
+
+/**
+ * run_in_bands(threads, count, work)
+ *
+ * Helper to split the range [0, count) into one band per thread and run work(begin, end) on each.
+ */
+template <typename Work>
+static void run_in_bands(int threads, int count, Work work){
+    std::vector<std::thread> workers;
+    for(int t = 0; t < threads; t++){
+        int begin = int((std::int64_t(count) * t) / threads);
+        int end = int((std::int64_t(count) * (t + 1)) / threads);
+        workers.emplace_back(work, begin, end);
+    }
+    for(std::thread& worker : workers){
+        worker.join();
+    }
+}
+
+/**
+ * Census::canonical(pattern)
+ *
+ * Put a pattern into its canonical form, so equal objects can be compared whatever their position or orientation.
+ * The pattern is cropped to the bounding box of its alive cells and then rotated and reflected
+ * into the orientation with the smallest hash.
+ *
+ * @example
+ *
+ *      // A glider and an upside down glider have the same canonical form
+ *      std::cout << (Census::canonical(Zoo::glider()) == Census::canonical(Zoo::glider().rotate(2))) << std::endl;
+ *
+ * @param pattern
+ *      The grid containing the object.
+ *
+ * @return
+ *      Returns the canonical form of the pattern, or an empty 0x0 grid if no cells are alive.
+ */
+Grid Census::canonical(const Grid& pattern){
+    Bounds box = pattern.get_bounding_box();
+    if(box.x0 >= box.x1){
+        return Grid();
+    }
+
+    //the orientations tried are short-lived, so they reuse the memory of a per-thread arena
+    static thread_local GridArena arena;
+    Grid best;
+    {
+        ArenaScope scope(arena);
+        Grid cropped = pattern.crop(box.x0, box.y0, box.x1, box.y1);
+        std::uint64_t bestHash = cropped.hash();
+        best = cropped;
+
+        //nested loops that try all eight orientations and keep the one with the smallest hash
+        for(int reflected = 0; reflected < 2; reflected++){
+            Grid base = reflected ? cropped.reflect() : cropped;
+            for(int rotation = 0; rotation < 4; rotation++){
+                Grid oriented = base.rotate(rotation);
+                std::uint64_t hash = oriented.hash();
+                if(hash < bestHash){
+                    //copying into best keeps it in memory from outside the arena
+                    best = oriented;
+                    bestHash = hash;
+                }
+            }
+        }
+    }
+    return best;
+}
+
+/**
+ * Census::Table::Table()
+ *
+ * Construct a table that knows the creatures in the Zoo.
+ * Gliders and light weight spaceships are added in all four of their phases.
+ *
+ * @example
+ *
+ *      // Make a table of the Zoo creatures
+ *      Census::Table table;
+ *
+ */
+Census::Table::Table(){
+    add("glider", Zoo::glider(), 4);
+    add("r-pentomino", Zoo::r_pentomino());
+    add("light weight spaceship", Zoo::light_weight_spaceship(), 4);
+}
+
+/**
+ * Census::Table::add(name, pattern, phases = 1)
+ *
+ * Add an object to the table.
+ * The object is simulated for the given number of phases and each phase is added under the same name.
+ * Objects already in the table keep their original name.
+ *
+ * @example
+ *
+ *      // Make a table and teach it the blinker in both of its phases
+ *      Census::Table table;
+ *      Grid blinker(3, 1);
+ *      blinker(0, 0) = blinker(1, 0) = blinker(2, 0) = Cell::ALIVE;
+ *      table.add("blinker", blinker, 2);
+ *
+ * @param name
+ *      The name to report the object as.
+ *
+ * @param pattern
+ *      A grid containing the object.
+ *
+ * @param phases
+ *      Optional parameter. The number of generations of the object to add. Defaults to 1.
+ */
+void Census::Table::add(std::string name, Grid pattern, int phases){
+    //pad the pattern so a spaceship cannot reach the edge of the world in the given phases
+    int pad = phases + 2;
+    Grid padded(pattern.get_width() + (2 * pad), pattern.get_height() + (2 * pad));
+    padded.merge(pattern, pad, pad);
+    World world(padded);
+
+    //loop that records each phase of the object
+    for(int phase = 0; phase < phases; phase++){
+        Grid form = canonical(world.get_state());
+        if(form.get_width() > 0 && names.count(form) == 0){
+            names[form] = name;
+        }
+        world.step();
+    }
+}
+
+/**
+ * Census::Table::load(path, phases = 1)
+ *
+ * Add an object to the table from an ascii .gol file, named after the file.
+ *
+ * @example
+ *
+ *      // Make a table and teach it the pulsar, which will be named "pulsar"
+ *      Census::Table table;
+ *      table.load("path/to/pulsar.gol", 3);
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @param phases
+ *      Optional parameter. The number of generations of the object to add. Defaults to 1.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be loaded by Zoo::load_ascii.
+ */
+void Census::Table::load(std::string path, int phases){
+    //name the object after the file, without its directory or extension
+    std::string name = path.substr(path.find_last_of("/\\") + 1);
+    name = name.substr(0, name.find_last_of('.'));
+    add(name, Zoo::load_ascii(path), phases);
+}
+
+/**
+ * Census::Table::get_size()
+ *
+ * Gets the number of distinct object forms in the table, counting each phase separately.
+ *
+ * @return
+ *      The number of forms in the table.
+ */
+int Census::Table::get_size() const{
+    return int(names.size());
+}
+
+/**
+ * Census::Table::contains(canonical_pattern)
+ *
+ * Checks if an object in canonical form is known to the table.
+ *
+ * @param canonical_pattern
+ *      An object in the form returned by Census::canonical.
+ *
+ * @return
+ *      Returns true if the table has a name for the object.
+ */
+bool Census::Table::contains(const Grid& canonical_pattern) const{
+    return names.count(canonical_pattern) > 0;
+}
+
+/**
+ * Census::Table::get_name(canonical_pattern)
+ *
+ * Gets the name of an object in canonical form.
+ * Unknown objects are named after their population and hash, e.g. "unnamed_6_00c0ffee00c0ffee".
+ *
+ * @param canonical_pattern
+ *      An object in the form returned by Census::canonical.
+ *
+ * @return
+ *      Returns the name of the object.
+ */
+std::string Census::Table::get_name(const Grid& canonical_pattern) const{
+    auto found = names.find(canonical_pattern);
+    if(found != names.end()){
+        return found->second;
+    }
+
+    char hex[17];
+    std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)canonical_pattern.hash());
+    return "unnamed_" + std::to_string(canonical_pattern.get_alive_cells()) + "_" + hex;
+}
+
+/**
+ * Census::take(grid, table, threads = 1, radius = 2)
+ *
+ * Count every object in a grid.
+ *
+ * The alive cells of each row are split into runs, and runs on nearby rows are joined into one object
+ * when a cell of one is within radius cells (horizontally, vertically or diagonally) of a cell of the other.
+ * Each object is cropped out, put into canonical form and looked up in the table.
+ *
+ * @example
+ *
+ *      // Run a world for a while and print what is left
+ *      World world(Zoo::load_ascii("path/to/soup.gol"));
+ *      world.advance(1000);
+ *      for (Census::Object object : Census::take(world.get_state(), Census::Table(), 8)) {
+ *          std::cout << object.count << " x " << object.name << std::endl;
+ *      }
+ *
+ * @param grid
+ *      The grid to take a census of.
+ *
+ * @param table
+ *      The table used to name the objects.
+ *
+ * @param threads
+ *      Optional parameter. The number of threads to share the work between. Defaults to 1.
+ *
+ * @param radius
+ *      Optional parameter. How far apart two alive cells can be while still belonging to the same object,
+ *      where 1 joins only touching cells. Defaults to 2.
+ *
+ * @return
+ *      Returns each kind of object found with its count, most common first.
+ */
+std::vector<Census::Object> Census::take(const Grid& grid, const Table& table, int threads, int radius){
+    threads = std::max(threads, 1);
+    radius = std::max(radius, 1);
+    int height = grid.get_height();
+
+    //find the runs of alive cells in each row by scanning the packed row for set bits
+    std::vector<std::vector<Run>> rowRuns(height);
+    run_in_bands(threads, height, [&](int y0, int y1){
+        std::vector<std::uint64_t> words(grid.get_row_words());
+        for(int y = y0; y < y1; y++){
+            grid.pack_row(y, words.data());
+            int x = 0;
+            int width = int(words.size()) * 64;
+            while(x < width){
+                //skip dead cells, then measure the run of alive cells that follows
+                std::uint64_t ahead = words[x / 64] >> (x % 64);
+                if(ahead == 0){
+                    x = ((x / 64) + 1) * 64;
+                    continue;
+                }
+                int start = x + __builtin_ctzll(ahead);
+                int end = start;
+                while(end < width){
+                    std::uint64_t gaps = ~words[end / 64] >> (end % 64);
+                    if(gaps == 0){
+                        end = ((end / 64) + 1) * 64;
+                        continue;
+                    }
+                    end += __builtin_ctzll(gaps);
+                    break;
+                }
+                rowRuns[y].push_back({start, end, y});
+                x = end;
+            }
+        }
+    });
+
+    //number the runs, with the runs of row y starting at rowStart[y]
+    std::vector<int> rowStart(height + 1, 0);
+    for(int y = 0; y < height; y++){
+        rowStart[y + 1] = rowStart[y] + int(rowRuns[y].size());
+    }
+    int runCount = rowStart[height];
+    std::vector<std::atomic<int>> parent(runCount);
+    for(int i = 0; i < runCount; i++){
+        parent[i].store(i);
+    }
+
+    //join each run to the runs within reach on its own row and the rows below it
+    run_in_bands(threads, height, [&](int y0, int y1){
+        for(int y = y0; y < y1; y++){
+            const std::vector<Run>& row = rowRuns[y];
+            for(int i = 0; i + 1 < int(row.size()); i++){
+                if(row[i + 1].x0 - (row[i].x1 - 1) <= radius){
+                    join_runs(parent, rowStart[y] + i, rowStart[y] + i + 1);
+                }
+            }
+            for(int d = 1; d <= radius && y + d < height; d++){
+                const std::vector<Run>& below = rowRuns[y + d];
+                std::size_t j = 0;
+                for(int i = 0; i < int(row.size()); i++){
+                    //skip the runs below that end too far left to reach this run or any after it
+                    while(j < below.size() && below[j].x1 - 1 < row[i].x0 - radius){
+                        j++;
+                    }
+                    for(std::size_t k = j; k < below.size() && below[k].x0 <= row[i].x1 - 1 + radius; k++){
+                        join_runs(parent, rowStart[y] + i, rowStart[y + d] + int(k));
+                    }
+                }
+            }
+        }
+    });
+
+    //give each group of runs an object number and collect the runs of each object together
+    std::vector<int> objectOf(runCount);
+    std::vector<int> objectStart(1, 0);
+    for(int i = 0; i < runCount; i++){
+        int root = find_root(parent, i);
+        if(root == i){
+            objectOf[i] = int(objectStart.size()) - 1;
+            objectStart.push_back(0);
+        }else{
+            objectOf[i] = objectOf[root];
+        }
+        objectStart[objectOf[i] + 1]++;
+    }
+    int objectCount = int(objectStart.size()) - 1;
+    for(int i = 0; i < objectCount; i++){
+        objectStart[i + 1] += objectStart[i];
+    }
+    std::vector<Run> objectRuns(runCount);
+    std::vector<int> filled(objectStart.begin(), objectStart.end() - 1);
+    for(int y = 0; y < height; y++){
+        for(int i = 0; i < int(rowRuns[y].size()); i++){
+            objectRuns[filled[objectOf[rowStart[y] + i]]++] = rowRuns[y][i];
+        }
+    }
+
+    //crop out each object and count the distinct shapes, before any rotation, on each thread
+    std::vector<std::unordered_map<Grid, int>> shapes(threads);
+    std::atomic<int> band(0);
+    run_in_bands(threads, objectCount, [&](int begin, int end){
+        std::unordered_map<Grid, int>& counts = shapes[band++];
+        for(int o = begin; o < end; o++){
+            Bounds box = {grid.get_width(), height, 0, 0};
+            for(int i = objectStart[o]; i < objectStart[o + 1]; i++){
+                box.x0 = std::min(box.x0, objectRuns[i].x0);
+                box.x1 = std::max(box.x1, objectRuns[i].x1);
+                box.y0 = std::min(box.y0, objectRuns[i].y);
+                box.y1 = std::max(box.y1, objectRuns[i].y + 1);
+            }
+            Grid shape(box.x1 - box.x0, box.y1 - box.y0);
+            for(int i = objectStart[o]; i < objectStart[o + 1]; i++){
+                for(int x = objectRuns[i].x0; x < objectRuns[i].x1; x++){
+                    shape(x - box.x0, objectRuns[i].y - box.y0) = Cell::ALIVE;
+                }
+            }
+            counts[shape]++;
+        }
+    });
+
+    //put each distinct shape into canonical form once and total up the objects
+    std::unordered_map<Grid, int> totals;
+    for(const std::unordered_map<Grid, int>& counts : shapes){
+        for(const auto& shape : counts){
+            totals[canonical(shape.first)] += shape.second;
+        }
+    }
+
+    std::vector<Object> objects;
+    for(const auto& total : totals){
+        objects.push_back({table.get_name(total.first), total.first, total.second});
+    }
+    std::sort(objects.begin(), objects.end(), [](const Object& a, const Object& b){
+        if(a.count != b.count){return a.count > b.count;}
+        return a.name < b.name;
+    });
+    return objects;
+}
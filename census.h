@@ -0,0 +1,55 @@
+/**
+ * Declares a Census namespace with methods for counting the objects left on a Grid after a run.
+ * Rich documentation for the api and behaviour the Census namespace can be found in census.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the namespace.
+// #include ...
+#include "grid.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+/**
+ * Declare the interface of the Census namespace for naming and counting the objects in a grid.
+ */
+namespace Census {
+
+    /**
+     * An Object is one kind of object found by a census.
+     *      - pattern is the object in its canonical orientation, cropped to its bounding box.
+     *      - name comes from the Table, or is generated from the pattern if the object is not in the table.
+     *      - count is how many times the object was found.
+     */
+    struct Object {
+        std::string name;
+        Grid pattern;
+        int count;
+    };
+
+    /**
+     * A Table of known objects, stored by their canonical form so any orientation or position matches.
+     */
+    class Table {
+        private:
+            std::unordered_map<Grid, std::string> names;
+
+        public:
+            Table();
+
+            void add(std::string name, Grid pattern, int phases = 1);
+            void load(std::string path, int phases = 1);
+
+            int get_size() const;
+            bool contains(const Grid& canonical_pattern) const;
+            std::string get_name(const Grid& canonical_pattern) const;
+    };
+
+    Grid canonical(const Grid& pattern);
+    std::vector<Object> take(const Grid& grid, const Table& table, int threads = 1, int radius = 2);
+
+};
@@ -0,0 +1,399 @@
+/**
+ * Implements a Collision namespace with methods for searching the collisions between small objects.
+ *      - A search tries every combination of the ways each object can be placed, its position, phase and rotation,
+ *        runs each collision for a number of generations and sorts the results by what they ended up as.
+ *          - Collisions are numbered in a fixed order, with the last object's placements counting fastest, so any
+ *            collision can be found again from its number.
+ *          - Phases and rotations of an object that look the same, such as the four rotations of a block, are only
+ *            tried once.
+ *          - Placements where two objects start within two cells of each other would react at once, so they are
+ *            counted as overlaps and not run.
+ *
+ *      - Collisions are run on a plane with room around the objects for anything they give off to stay clear of
+ *        the edges for the whole run.
+ *          - Nothing in B3/S23 grows into empty space faster than half the speed of light, so Conway's rule gets
+ *            room for that. Other rules, such as those with B2 whose debris can grow at the speed of light, get
+ *            room for a cell a generation.
+ *          - Collisions in totalistic rules are run 64 at a time as one block of a SoupBatch, one collision per bit.
+ *          - Collisions in other rules are run one at a time in a World.
+ *
+ *      - Results are told apart by Grid::hash(true), so the same result anywhere on the plane is the same outcome.
+ *          - Only the first collision to give each outcome keeps its result and placements, later ones are counted
+ *            as duplicates.
+ *          - Collisions whose result is exactly what the objects become when run on their own are misses, and are
+ *            counted but not kept.
+ *
+ *      - Searches run on every core by default, each thread taking the next 64 collisions as it finishes.
+ *          - Each thread keeps its own outcomes, merged once every collision is done, keeping the earliest
+ *            collision of each, so the report is the same for any number of threads.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "collision.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include "world.h"
+#include "parallel.h"
+#include "soup_batch.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+#include <unordered_set>
+#include <utility>
+
+namespace {
+
+/**
+ * A Variant is one distinct phase and rotation of an object.
+ *      - cells are its alive cells relative to the top left corner of its bounding box.
+ *      - alone are the alive cells it becomes after the run when nothing else is there, relative to the same corner.
+ */
+struct Variant {
+    int phase;
+    int rotation;
+    int width;
+    int height;
+    std::vector<std::pair<int, int>> cells;
+    std::vector<std::pair<int, int>> alone;
+};
+
+/**
+ * A Tally is the outcomes, by hash, found by one thread of a search, along with the space the thread builds each
+ * chunk of collisions in.
+ */
+struct Tally {
+    Parallel::Finds<std::uint64_t, Collision::Outcome> outcomes;
+    long long overlaps;
+    long long misses;
+    std::vector<std::vector<std::pair<const Variant*, std::pair<int, int>>>> chosen;
+    std::vector<bool> overlapped;
+    std::vector<std::uint64_t> cells;
+};
+
+}
+
+/**
+ * run_alone(pattern, steps, rule, cells)
+ *
+ * Helper to run a pattern on its own on a plane large enough that nothing reaches the edge, listing the alive cells
+ * it ends up with relative to its starting top left corner.
+ */
+static void run_alone(const Grid& pattern, int steps, const Rule& rule, std::vector<std::pair<int, int>>& cells){
+    int pad = steps + 2;
+    Grid padded(pattern.get_width() + (2 * pad), pattern.get_height() + (2 * pad));
+    padded.merge(pattern, pad, pad);
+    World world(padded);
+    world.set_rule(rule);
+    world.advance(steps, Topology::PLANE);
+
+    cells.clear();
+    const Grid& state = world.get_state();
+    for(int y = 0; y < state.get_height(); y++){
+        for(int x = 0; x < state.get_width(); x++){
+            if(state(x, y) == Cell::ALIVE){
+                cells.push_back({x - pad, y - pad});
+            }
+        }
+    }
+}
+
+/**
+ * make_variants(object, settings)
+ *
+ * Helper to list the distinct phases and rotations of an object.
+ */
+static std::vector<Variant> make_variants(const Collision::Object& object, const Collision::Settings& settings){
+    std::vector<Variant> variants;
+    std::unordered_set<std::uint64_t> seen;
+    for(int rotation = 0; rotation < (object.orientations ? 4 : 1); rotation++){
+        Grid turned = object.pattern.rotate(rotation);
+        std::vector<std::pair<int, int>> cells;
+        for(int phase = 0; phase < object.phases; phase++){
+            //run each phase on from the first, then crop the cells it ends up with to their bounding box
+            run_alone(turned, phase, settings.rule, cells);
+            if(cells.empty()){
+                continue;
+            }
+            Variant variant = {phase, rotation, 0, 0, {}, {}};
+            int x0 = cells[0].first;
+            int y0 = cells[0].second;
+            int x1 = x0;
+            int y1 = y0;
+            for(const std::pair<int, int>& cell : cells){
+                x0 = std::min(x0, cell.first);
+                x1 = std::max(x1, cell.first);
+                y1 = std::max(y1, cell.second);
+            }
+            Grid cropped((x1 - x0) + 1, (y1 - y0) + 1);
+            for(const std::pair<int, int>& cell : cells){
+                variant.cells.push_back({cell.first - x0, cell.second - y0});
+                cropped(cell.first - x0, cell.second - y0) = Cell::ALIVE;
+            }
+            if(!seen.insert(cropped.hash()).second){
+                continue;
+            }
+            variant.width = cropped.get_width();
+            variant.height = cropped.get_height();
+            run_alone(cropped, settings.generations, settings.rule, variant.alone);
+            variants.push_back(variant);
+        }
+    }
+    return variants;
+}
+
+/**
+ * overlapping(a, ax, ay, b, bx, by)
+ *
+ * Helper to check whether two placed variants have alive cells within two cells of each other, so some cell next
+ * to both could be born or die from the two together straight away.
+ */
+static bool overlapping(const Variant& a, int ax, int ay, const Variant& b, int bx, int by){
+    if(ax + a.width + 2 <= bx || bx + b.width + 2 <= ax || ay + a.height + 2 <= by || by + b.height + 2 <= ay){
+        return false;
+    }
+    for(const std::pair<int, int>& p : a.cells){
+        for(const std::pair<int, int>& q : b.cells){
+            if(std::abs((ax + p.first) - (bx + q.first)) <= 2 && std::abs((ay + p.second) - (by + q.second)) <= 2){
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Collision::search(objects, settings, progress)
+ *
+ * Run every collision between a set of objects and list the distinct outcomes.
+ *
+ * @example
+ *
+ *      // Fire a glider at a block from every lane and timing that reaches it
+ *      Grid block(2, 2);
+ *      block(0, 0) = block(1, 0) = block(0, 1) = block(1, 1) = Cell::ALIVE;
+ *      Collision::Object target = {block};
+ *      Collision::Object glider = {Zoo::glider(), -16, -8, -2, -7, 4};
+ *      Collision::Report report = Collision::search({target, glider}, Collision::Settings());
+ *      for(const Collision::Outcome& outcome : report.outcomes){
+ *          std::cout << outcome.count << " collisions gave" << std::endl << outcome.result << std::endl;
+ *      }
+ *
+ * @param objects
+ *      The objects to collide, with the placements to try for each.
+ *
+ * @param settings
+ *      The rule, number of generations and threads of the search, see Collision::Settings.
+ *
+ * @param progress
+ *      Optional parameter. Called from the calling thread about once a second, and once at the end, with the number
+ *      of collisions done and the seconds since the search started.
+ *
+ * @return
+ *      The distinct outcomes found, with the counts of collisions that overlapped or missed.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if there are no objects, an object has no alive cells or no
+ *      placements, the rule has more than two states, or there are too many collisions to number.
+ */
+Collision::Report Collision::search(const std::vector<Object>& objects, const Settings& settings,
+                                    std::function<void(long long collisions, double seconds)> progress){
+    //exception
+    if(objects.empty() || settings.generations < 0){
+        throw std::runtime_error("no objects to collide or negative generations");
+    }
+    //exception
+    if(settings.rule.get_states() != 2){
+        throw std::runtime_error("rule has more than two states");
+    }
+    auto start = std::chrono::steady_clock::now();
+
+    //list the variants of each object and how many placements it has, and the area they can reach
+    std::vector<std::vector<Variant>> variants;
+    std::vector<long long> placements;
+    long long collisions = 1;
+    int x0 = 0;
+    int y0 = 0;
+    int x1 = 0;
+    int y1 = 0;
+    for(const Object& object : objects){
+        variants.push_back(make_variants(object, settings));
+        //exception
+        if(variants.back().empty() || object.x1 <= object.x0 || object.y1 <= object.y0 || object.phases < 1){
+            throw std::runtime_error("object has no alive cells or no placements");
+        }
+        placements.push_back(static_cast<long long>(variants.back().size()) * (object.x1 - object.x0) *
+                             (object.y1 - object.y0));
+        //exception
+        if(collisions > (1LL << 52) / placements.back()){
+            throw std::runtime_error("too many collisions");
+        }
+        collisions *= placements.back();
+        for(const Variant& variant : variants.back()){
+            x0 = std::min(x0, object.x0);
+            y0 = std::min(y0, object.y0);
+            x1 = std::max(x1, (object.x1 - 1) + variant.width);
+            y1 = std::max(y1, (object.y1 - 1) + variant.height);
+        }
+    }
+    int margin = (settings.rule.is_standard() ? (settings.generations / 2) : settings.generations) + 2;
+    int width = (x1 - x0) + (2 * margin);
+    int height = (y1 - y0) + (2 * margin);
+    int originX = margin - x0;
+    int originY = margin - y0;
+
+    int threads = Parallel::get_threads(settings.threads);
+
+    //runs every collision a thread takes, 64 at a time so totalistic rules can run them as one block of a SoupBatch
+    const long long chunk = 64;
+    auto worker = [&](Tally& tally, long long first, long long last){
+        std::vector<std::vector<std::pair<const Variant*, std::pair<int, int>>>>& chosen = tally.chosen;
+        std::vector<bool>& overlaps = tally.overlapped;
+        std::vector<std::uint64_t>& cells = tally.cells;
+
+        //number the placements of each collision, the last object counting fastest
+        for(long long index = first; index < last; index++){
+            int lane = int(index - first);
+            chosen[lane].assign(objects.size(), {nullptr, {0, 0}});
+            long long rest = index;
+            for(int o = int(objects.size()) - 1; o >= 0; o--){
+                long long place = rest % placements[o];
+                rest /= placements[o];
+                int spanX = objects[o].x1 - objects[o].x0;
+                long long kinds = static_cast<long long>(variants[o].size());
+                const Variant* variant = &variants[o][std::size_t(place % kinds)];
+                place /= kinds;
+                int x = objects[o].x0 + int(place % spanX);
+                int y = objects[o].y0 + int(place / spanX);
+                chosen[lane][o] = {variant, {x, y}};
+            }
+            overlaps[lane] = false;
+            for(std::size_t a = 0; a < objects.size() && !overlaps[lane]; a++){
+                for(std::size_t b = a + 1; b < objects.size() && !overlaps[lane]; b++){
+                    overlaps[lane] = overlapping(*chosen[lane][a].first, chosen[lane][a].second.first,
+                                                 chosen[lane][a].second.second, *chosen[lane][b].first,
+                                                 chosen[lane][b].second.first, chosen[lane][b].second.second);
+                }
+            }
+        }
+
+        //build a grid of each collision that does not overlap
+        auto build = [&](int lane, std::uint64_t bit, Grid* grid){
+            for(const std::pair<const Variant*, std::pair<int, int>>& placed : chosen[lane]){
+                for(const std::pair<int, int>& cell : placed.first->cells){
+                    int x = originX + placed.second.first + cell.first;
+                    int y = originY + placed.second.second + cell.second;
+                    if(grid){
+                        (*grid)(x, y) = Cell::ALIVE;
+                    }
+                    else{
+                        cells[(std::size_t(y) * width) + x] |= bit;
+                    }
+                }
+            }
+        };
+
+        //tally the result of a collision, unless it is a miss
+        auto count = [&](long long index, const Grid& result){
+            int lane = int(index - first);
+            std::size_t expected = 0;
+            bool miss = true;
+            for(const std::pair<const Variant*, std::pair<int, int>>& placed : chosen[lane]){
+                expected += placed.first->alone.size();
+                for(const std::pair<int, int>& cell : placed.first->alone){
+                    int x = originX + placed.second.first + cell.first;
+                    int y = originY + placed.second.second + cell.second;
+                    if(miss && (x < 0 || y < 0 || x >= width || y >= height || result(x, y) != Cell::ALIVE)){
+                        miss = false;
+                    }
+                }
+            }
+            int population = result.get_alive_cells();
+            if(miss && std::size_t(population) == expected){
+                tally.misses++;
+                return;
+            }
+
+            std::uint64_t hash = result.hash(true);
+            auto added = tally.outcomes.add(hash, index);
+            if(!added.second){
+                return;
+            }
+            Outcome& outcome = added.first.sample;
+            Bounds box = result.get_bounding_box();
+            outcome.hash = hash;
+            outcome.result = population ? result.crop(box.x0, box.y0, box.x1, box.y1) : Grid();
+            outcome.population = population;
+            outcome.first = index;
+            for(const std::pair<const Variant*, std::pair<int, int>>& placed : chosen[lane]){
+                outcome.placements.push_back({placed.second.first, placed.second.second, placed.first->phase,
+                                              placed.first->rotation});
+            }
+        };
+
+        if(settings.rule.is_totalistic()){
+            std::fill(cells.begin(), cells.end(), 0);
+            for(long long index = first; index < last; index++){
+                if(!overlaps[index - first]){
+                    build(int(index - first), std::uint64_t(1) << (index - first), nullptr);
+                }
+            }
+            SoupBatch batch(width, height, int(last - first), settings.rule);
+            batch.set_block(0, cells);
+            batch.advance(settings.generations);
+            for(long long index = first; index < last; index++){
+                if(!overlaps[index - first]){
+                    count(index, batch.get_world(int(index - first)));
+                }
+            }
+        }
+        else{
+            for(long long index = first; index < last; index++){
+                if(!overlaps[index - first]){
+                    Grid grid(width, height);
+                    build(int(index - first), 0, &grid);
+                    World world(grid);
+                    world.set_rule(settings.rule);
+                    world.advance(settings.generations, Topology::PLANE);
+                    count(index, world.get_state());
+                }
+            }
+        }
+        for(long long index = first; index < last; index++){
+            tally.overlaps += overlaps[index - first] ? 1 : 0;
+        }
+    };
+    auto seconds = [&](){
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    Tally empty = {Parallel::Finds<std::uint64_t, Outcome>(), 0, 0,
+                   std::vector<std::vector<std::pair<const Variant*, std::pair<int, int>>>>(chunk),
+                   std::vector<bool>(chunk), std::vector<std::uint64_t>(std::size_t(width) * height)};
+    std::vector<Tally> tallies = Parallel::run_chunks(threads, collisions, chunk, empty, worker, [&](long long done){
+        if(progress){
+            progress(done, seconds());
+        }
+    });
+
+    //merge the tallies, keeping the earliest collision of each outcome so the report does not depend on the threads
+    Report report = {collisions, 0, 0, seconds(), {}};
+    for(std::size_t t = 0; t < tallies.size(); t++){
+        if(t > 0){
+            tallies[0].outcomes.merge(tallies[t].outcomes);
+        }
+        report.overlaps += tallies[t].overlaps;
+        report.misses += tallies[t].misses;
+    }
+    for(const auto& merged : tallies[0].outcomes.list()){
+        Outcome outcome = merged.sample;
+        outcome.count = merged.count;
+        outcome.first = merged.first;
+        report.outcomes.push_back(outcome);
+    }
+    if(progress){
+        progress(report.collisions, report.seconds);
+    }
+    return report;
+}
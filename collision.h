@@ -0,0 +1,93 @@
+/**
+ * Declares a Collision namespace with methods for searching the collisions between small objects.
+ * Rich documentation for the api and behaviour the Collision namespace can be found in collision.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the namespace.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * Declare the interface of the Collision namespace for colliding objects in every relative position.
+ */
+namespace Collision {
+
+    /**
+     * An Object is one of the objects in a collision, with the ways it can be placed.
+     *      - x0, y0, x1, y1 are the half open ranges of the top left corner of its bounding box, relative to every
+     *        other object's, so an object with a single position such as a target can sit at 0, 0, 1, 1.
+     *      - phases is the number of generations the object is run through before being placed, one try each.
+     *      - orientations tries the object turned by Grid::rotate to all four directions as well.
+     */
+    struct Object {
+        Grid pattern;
+        int x0 = 0;
+        int y0 = 0;
+        int x1 = 1;
+        int y1 = 1;
+        int phases = 1;
+        bool orientations = false;
+    };
+
+    /**
+     * A Placement is where one object of a collision was put, and in which phase and rotation.
+     */
+    struct Placement {
+        int x;
+        int y;
+        int phase;
+        int rotation;
+    };
+
+    /**
+     * Settings for a collision search.
+     *      - generations is the number of steps each collision is run for before its result is taken.
+     *      - threads is the number of threads to search with, or 0 for one per core.
+     */
+    struct Settings {
+        int generations = 128;
+        int threads = 0;
+        Rule rule;
+    };
+
+    /**
+     * An Outcome is one distinct result found by a collision search.
+     *      - hash is the Grid::hash(true) of the result, which tells outcomes apart wherever they ended up.
+     *      - result is the result cropped to its bounding box.
+     *      - count is the number of collisions that gave it, and placements the first of them in search order.
+     */
+    struct Outcome {
+        std::uint64_t hash;
+        Grid result;
+        int population;
+        long long count;
+        long long first;
+        std::vector<Placement> placements;
+    };
+
+    /**
+     * A Report sums up a collision search.
+     *      - overlaps are placements where the objects started too close to be told apart, which are not run.
+     *      - misses are collisions where the objects never touched, which are not listed as outcomes.
+     *      - outcomes are every distinct result, in order of the first collision that gave them.
+     */
+    struct Report {
+        long long collisions;
+        long long overlaps;
+        long long misses;
+        double seconds;
+        std::vector<Outcome> outcomes;
+    };
+
+    Report search(const std::vector<Object>& objects, const Settings& settings,
+                  std::function<void(long long collisions, double seconds)> progress = nullptr);
+
+};
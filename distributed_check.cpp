@@ -0,0 +1,189 @@
+/**
+ * A differential check of DistributedWorld against World, run as its own program.
+ *      - Each case splits a random world between a number of processes forked from this one, advances it over
+ *        a transport, gathers it to rank 0 and compares it with the same world advanced by World.
+ *          - Every case is run over both SharedMemoryTransport and TcpTransport, for each topology
+ *            DistributedWorld supports and for a rule with and without B6.
+ *
+ *      - The cases are chosen to cover what is easy to get wrong.
+ *          - A long world split in two, with rings far smaller than the edges sent every generation, so ranks
+ *            that fill each other's rings at once must drain what they are sent while they wait to send.
+ *          - Worlds split into subdomains one cell wide or high, including a torus where a rank is its own
+ *            neighbour on several sides.
+ *
+ *      - Every process sets an alarm for each case, so a deadlock ends the check with a failure rather than hanging.
+ *      - Prints each case that fails, and exits with 0 if every case matched or 1 if any did not.
+ *
+ * @example
+ *
+ *      // Build and run the check, with the TCP ranks listening on ports from 20000, below the ephemeral ports
+ *      g++ -std=c++20 -pthread -o distributed_check distributed_check.cpp distributed_world.cpp transport.cpp ...
+ *      ./distributed_check 20000
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "distributed_world.h"
+#include "transport.h"
+#include "world.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <cstddef>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+/**
+ * A Split is one way of dividing a world between processes, with the ring capacity the shared memory uses.
+ */
+struct Split {
+    int width;
+    int height;
+    int columns;
+    int rows;
+    std::size_t capacity;
+    int generations;
+};
+
+}
+
+/**
+ * random_grid(width, height, seed)
+ *
+ * Gets a grid with about a third of its cells alive, the same for the same seed.
+ */
+static Grid random_grid(int width, int height, unsigned int seed){
+    Grid grid(width, height);
+    std::mt19937 generator(seed);
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            if(generator() % 3 == 0){
+                grid(x, y) = Cell::ALIVE;
+            }
+        }
+    }
+    return grid;
+}
+
+/**
+ * run_rank(split, rule, topology, start, tcp, name, port, rank)
+ *
+ * Join the split as one rank, advance the world and gather it to rank 0.
+ *
+ * @return
+ *      The gathered world on rank 0, or an empty grid on the other ranks.
+ */
+static Grid run_rank(const Split& split, const Rule& rule, Topology topology, const Grid& start, bool tcp,
+                     const std::string& name, int port, int rank){
+    int ranks = split.columns * split.rows;
+    std::unique_ptr<Transport> transport;
+    if(tcp){
+        transport = std::make_unique<TcpTransport>(rank, ranks, port);
+    }else{
+        transport = std::make_unique<SharedMemoryTransport>(name, rank, ranks, split.capacity);
+    }
+    DistributedWorld world(split.width, split.height, split.columns, split.rows, *transport, topology);
+    world.set_rule(rule);
+    world.set_state(start);
+    world.advance(split.generations);
+    return world.gather(0);
+}
+
+/**
+ * check(split, rule, topology, tcp, name, port)
+ *
+ * Run one case on columns * rows processes, rank 0 being this one.
+ *
+ * @return
+ *      true if every rank finished and the gathered world matched World, false otherwise.
+ */
+static bool check(const Split& split, const Rule& rule, Topology topology, bool tcp, const std::string& name,
+                  int port){
+    Grid start = random_grid(split.width, split.height, unsigned(split.width * 31 + split.height));
+    alarm(60);
+    int ranks = split.columns * split.rows;
+
+    std::vector<pid_t> children;
+    for(int rank = 1; rank < ranks; rank++){
+        pid_t child = fork();
+        if(child == 0){
+            //the other ranks report only whether they got through
+            alarm(60);
+            try{
+                run_rank(split, rule, topology, start, tcp, name, port, rank);
+            }catch(const std::exception& error){
+                std::cerr << "rank " << rank << ": " << error.what() << std::endl;
+                _exit(1);
+            }
+            _exit(0);
+        }
+        children.push_back(child);
+    }
+
+    bool matched = false;
+    try{
+        Grid gathered = run_rank(split, rule, topology, start, tcp, name, port, 0);
+        World world(start);
+        world.set_rule(rule);
+        world.advance(split.generations, topology);
+        matched = gathered == world.get_state();
+    }catch(const std::exception& error){
+        std::cerr << "rank 0: " << error.what() << std::endl;
+    }
+    for(pid_t child : children){
+        int status = 0;
+        waitpid(child, &status, 0);
+        matched = matched && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+    alarm(0);
+    return matched;
+}
+
+int main(int argc, char* argv[]){
+    int port = argc > 1 ? std::atoi(argv[1]) : 20000;
+
+    std::vector<Split> splits = {
+        {4000, 40, 1, 2, 64, 20},
+        {3, 3, 3, 3, 64, 6},
+        {5, 4, 5, 2, 64, 8},
+        {2, 1, 2, 1, 64, 4},
+        {12, 9, 4, 3, 128, 12},
+    };
+    std::vector<Topology> topologies = {Topology::PLANE, Topology::TORUS, Topology::CYLINDER_HORIZONTAL,
+                                        Topology::CYLINDER_VERTICAL, Topology::BOUNDARY_ALIVE};
+    std::vector<std::string> rules = {"B3/S23", "B36/S23"};
+
+    int cases = 0;
+    int failures = 0;
+    for(const Split& split : splits){
+        for(Topology topology : topologies){
+            for(const std::string& rule : rules){
+                for(bool tcp : {false, true}){
+                    //give every case its own segment and ports, so nothing is left over from the last
+                    std::string name = "/distributed_check_" + std::to_string(getpid()) + "_" +
+                                       std::to_string(cases);
+                    if(!check(split, Rule(rule), topology, tcp, name, port)){
+                        std::cout << "MISMATCH " << split.width << "x" << split.height << " split "
+                                  << split.columns << "x" << split.rows << " topology " << int(topology)
+                                  << " rule " << rule << (tcp ? " over tcp" : " over shared memory") << std::endl;
+                        failures++;
+                    }
+                    port += split.columns * split.rows;
+                    cases++;
+                }
+            }
+        }
+    }
+
+    std::cout << (cases - failures) << " of " << cases << " cases matched" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
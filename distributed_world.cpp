@@ -0,0 +1,543 @@
+/**
+ * Implements a class representing one process's part of a world split across several processes.
+ *      - The world is split into a grid of columns x rows rectangular subdomains, as even in size as they can be,
+ *        and each is owned by one rank of a Transport, numbered across the top row first.
+ *          - Each rank only holds its own subdomain, so a world too large for one process can be split between
+ *            several, on one machine or many.
+ *
+ *      - Each subdomain is padded with a one cell halo holding copies of the cells just beyond it, which are
+ *        swapped with the eight neighbouring ranks every generation.
+ *          - Edges are packed 8 cells to a byte, and every edge going to the same rank is sent as one message,
+ *            so a rank whose neighbour is on several sides (or is itself, on a small torus) still sends one message.
+ *          - Both ends of a message agree on the order of its edges from the direction each is for, so no
+ *            extra information is needed to unpack it.
+ *          - Beyond the edges of the world the halo is dead, or alive for Topology::BOUNDARY_ALIVE, or wraps round
+ *            to the ranks on the far side for the torus and cylinders.
+ *
+ *      - A step overlaps the halo swap with the work that does not need it.
+ *          - The edges are sent first, then the cells of the subdomain away from its edges are stepped, then the
+ *            halo is received and the ring of cells along the edges is stepped.
+ *          - Cells are stepped a row at a time by step_row in rule.h, the same kernel World uses for the 9 cell
+ *            neighbourhood, so every two state rule gives the same result as World::step.
+ *
+ *      - The whole world can be gathered to one rank to check or save it.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "distributed_world.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <stdexcept>
+
+//directions to the eight neighbours, ordered so that the opposite of direction d is d ^ 1
+static const int DX[8] = {0, 0, -1, 1, -1, 1, 1, -1};
+static const int DY[8] = {-1, 1, 0, 0, -1, 1, -1, 1};
+
+/**
+ * DistributedWorld::DistributedWorld(width, height, columns, rows, transport, topology)
+ *
+ * Join a world split between the ranks of a transport, holding the subdomain owned by this rank with every cell
+ * dead. Every rank must construct it with the same size, split and topology.
+ *
+ * @example
+ *
+ *      // Split a 100000x100000 torus between 4 processes as a 2x2 grid, this process being rank 3
+ *      SharedMemoryTransport transport("/life_run_1", 3, 4);
+ *      DistributedWorld world(100000, 100000, 2, 2, transport, Topology::TORUS);
+ *
+ * @param width
+ *      The width of the whole world.
+ *
+ * @param height
+ *      The height of the whole world.
+ *
+ * @param columns
+ *      The number of subdomains across the world.
+ *
+ * @param rows
+ *      The number of subdomains down the world.
+ *
+ * @param transport
+ *      The transport to swap halos over, with columns * rows ranks. It must outlive the world.
+ *
+ * @param topology
+ *      Optional parameter. How the edges of the world are joined. Defaults to Topology::PLANE.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The width or height is not positive, or there are more subdomains across or down than cells.
+ *          - The transport does not have columns * rows ranks.
+ *          - The topology mirrors an edge, as the Klein bottle and cross surface do.
+ */
+DistributedWorld::DistributedWorld(int width, int height, int columns, int rows, Transport& transport,
+                                   Topology topology){
+    //exception
+    if(width < 1 || height < 1 || columns < 1 || rows < 1 || columns > width || rows > height){
+        throw std::runtime_error("world must be positive and have at least one cell per subdomain");
+    }
+    //exception
+    if(transport.get_ranks() != columns * rows){
+        throw std::runtime_error("transport must have one rank per subdomain");
+    }
+    //exception
+    if(topology == Topology::KLEIN_BOTTLE || topology == Topology::CROSS_SURFACE){
+        throw std::runtime_error("topology not supported across subdomains");
+    }
+    this->width = width;
+    this->height = height;
+    this->columns = columns;
+    this->rows = rows;
+    this->transport = &transport;
+    this->topology = topology;
+    this->generation = 0;
+    this->bounds = get_subdomain(transport.get_rank());
+
+    std::size_t cells = std::size_t((bounds.x1 - bounds.x0) + 2) * ((bounds.y1 - bounds.y0) + 2);
+    currentCells.assign(cells, 0);
+    nextCells.assign(cells, 0);
+    set_rule(Rule());
+}
+
+/**
+ * DistributedWorld::get_index(x, y)
+ *
+ * Gets the index of a cell of the padded subdomain, where x and y are relative to the subdomain's top left cell
+ * and run from -1 to its width or height to take in the halo.
+ * The function should be callable from a constant context.
+ */
+int DistributedWorld::get_index(int x, int y) const{
+    return (x + 1) + ((bounds.x1 - bounds.x0) + 2) * (y + 1);
+}
+
+/**
+ * DistributedWorld::get_subdomain(rank)
+ *
+ * Gets the cells of the world owned by a rank.
+ * The function should be callable from a constant context.
+ */
+Bounds DistributedWorld::get_subdomain(int rank) const{
+    int column = rank % columns;
+    int row = rank / columns;
+    return Bounds{int((std::int64_t(width) * column) / columns), int((std::int64_t(height) * row) / rows),
+                  int((std::int64_t(width) * (column + 1)) / columns), int((std::int64_t(height) * (row + 1)) / rows)};
+}
+
+/**
+ * DistributedWorld::get_neighbour(direction)
+ *
+ * Gets the rank owning the subdomain next to this one in a direction, or -1 if it is beyond the edge of the world.
+ * The function should be callable from a constant context.
+ */
+int DistributedWorld::get_neighbour(int direction) const{
+    int column = (transport->get_rank() % columns) + DX[direction];
+    int row = (transport->get_rank() / columns) + DY[direction];
+    bool wrapColumns = topology == Topology::TORUS || topology == Topology::CYLINDER_HORIZONTAL;
+    bool wrapRows = topology == Topology::TORUS || topology == Topology::CYLINDER_VERTICAL;
+    if(column < 0 || column >= columns){
+        if(!wrapColumns){
+            return -1;
+        }
+        column = (column + columns) % columns;
+    }
+    if(row < 0 || row >= rows){
+        if(!wrapRows){
+            return -1;
+        }
+        row = (row + rows) % rows;
+    }
+    return (row * columns) + column;
+}
+
+/**
+ * DistributedWorld::pack_edge(direction, message)
+ *
+ * Append the cells along the edge of the subdomain facing a direction to a message, 8 cells to a byte.
+ * The function should be callable from a constant context.
+ */
+void DistributedWorld::pack_edge(int direction, std::vector<std::uint8_t>& message) const{
+    int localWidth = bounds.x1 - bounds.x0;
+    int localHeight = bounds.y1 - bounds.y0;
+    int x = DX[direction] > 0 ? localWidth - 1 : 0;
+    int y = DY[direction] > 0 ? localHeight - 1 : 0;
+    int count = DX[direction] == 0 ? localWidth : (DY[direction] == 0 ? localHeight : 1);
+    int stepX = DX[direction] == 0 ? 1 : 0;
+    int stepY = DY[direction] == 0 ? 1 : 0;
+
+    for(int i = 0; i < count; i += 8){
+        std::uint8_t byte = 0;
+        for(int bit = 0; bit < 8 && i + bit < count; bit++){
+            byte |= std::uint8_t(currentCells[get_index(x + (stepX * (i + bit)), y + (stepY * (i + bit)))] << bit);
+        }
+        message.push_back(byte);
+    }
+}
+
+/**
+ * DistributedWorld::unpack_edge(direction, message, offset)
+ *
+ * Fill the halo on the side of the subdomain facing a direction from a message, starting at a byte offset.
+ * Returns the offset just past the edge.
+ */
+std::size_t DistributedWorld::unpack_edge(int direction, const std::vector<std::uint8_t>& message,
+                                          std::size_t offset){
+    int localWidth = bounds.x1 - bounds.x0;
+    int localHeight = bounds.y1 - bounds.y0;
+    int x = DX[direction] > 0 ? localWidth : (DX[direction] < 0 ? -1 : 0);
+    int y = DY[direction] > 0 ? localHeight : (DY[direction] < 0 ? -1 : 0);
+    int count = DX[direction] == 0 ? localWidth : (DY[direction] == 0 ? localHeight : 1);
+    int stepX = DX[direction] == 0 ? 1 : 0;
+    int stepY = DY[direction] == 0 ? 1 : 0;
+
+    //exception
+    if(offset + std::size_t((count + 7) / 8) > message.size()){
+        throw std::runtime_error("halo message too short");
+    }
+    for(int i = 0; i < count; i++){
+        currentCells[get_index(x + (stepX * i), y + (stepY * i))] = (message[offset + (i / 8)] >> (i % 8)) & 1;
+    }
+    return offset + std::size_t((count + 7) / 8);
+}
+
+/**
+ * DistributedWorld::step_cells(x0, y0, x1, y1)
+ *
+ * Step the cells of the subdomain in [x0, x1) x [y0, y1) into the next buffer, reading the current buffer and
+ * its halo.
+ */
+void DistributedWorld::step_cells(int x0, int y0, int x1, int y1){
+    for(int y = y0; y < y1; y++){
+        const std::uint8_t* above = &currentCells[get_index(x0 - 1, y - 1)];
+        const std::uint8_t* centre = &currentCells[get_index(x0 - 1, y)];
+        const std::uint8_t* below = &currentCells[get_index(x0 - 1, y + 1)];
+        std::uint8_t* next = &nextCells[get_index(x0, y)];
+        step_row(above, centre, below, x1 - x0, rule.get_transitions(), [&](int i, std::uint8_t state){
+            next[i] = state;
+        });
+    }
+}
+
+/**
+ * DistributedWorld::get_width()
+ *
+ * Gets the width of the whole world.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The width of the world.
+ */
+int DistributedWorld::get_width() const{
+    return this->width;
+}
+
+/**
+ * DistributedWorld::get_height()
+ *
+ * Gets the height of the whole world.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The height of the world.
+ */
+int DistributedWorld::get_height() const{
+    return this->height;
+}
+
+/**
+ * DistributedWorld::get_rank()
+ *
+ * Gets the rank of this process.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The rank owning this subdomain.
+ */
+int DistributedWorld::get_rank() const{
+    return transport->get_rank();
+}
+
+/**
+ * DistributedWorld::get_bounds()
+ *
+ * Gets the cells of the world owned by this rank.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The bounds of this rank's subdomain within the world.
+ */
+Bounds DistributedWorld::get_bounds() const{
+    return this->bounds;
+}
+
+/**
+ * DistributedWorld::get_generation()
+ *
+ * Gets the number of steps taken.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The generation of the world.
+ */
+int DistributedWorld::get_generation() const{
+    return this->generation;
+}
+
+/**
+ * DistributedWorld::get_alive_cells()
+ *
+ * Gets the number of alive cells in this rank's subdomain.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of alive cells owned by this rank.
+ */
+int DistributedWorld::get_alive_cells() const{
+    int alive = 0;
+    for(int y = 0; y < bounds.y1 - bounds.y0; y++){
+        for(int x = 0; x < bounds.x1 - bounds.x0; x++){
+            alive += currentCells[get_index(x, y)];
+        }
+    }
+    return alive;
+}
+
+/**
+ * DistributedWorld::get_rule()
+ *
+ * Gets the rule the world is simulated with.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A const reference to the rule.
+ */
+const Rule& DistributedWorld::get_rule() const{
+    return this->rule;
+}
+
+/**
+ * DistributedWorld::set_rule(new_rule)
+ *
+ * Sets the rule to simulate with. Every rank must set the same rule.
+ *
+ * @param new_rule
+ *      The two state rule to simulate with.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the rule has more than two states.
+ */
+void DistributedWorld::set_rule(Rule new_rule){
+    //exception
+    if(new_rule.get_states() != 2){
+        throw std::runtime_error("rule has more than two states");
+    }
+    this->rule = new_rule;
+}
+
+/**
+ * DistributedWorld::set_state(state)
+ *
+ * Sets this rank's subdomain from a grid of the whole world, so every rank can start from the same grid.
+ *
+ * @param state
+ *      A grid the size of the whole world.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the grid is not the size of the world.
+ */
+void DistributedWorld::set_state(const Grid& state){
+    //exception
+    if(state.get_width() != width || state.get_height() != height){
+        throw std::runtime_error("state must be the size of the world");
+    }
+    std::fill(currentCells.begin(), currentCells.end(), 0);
+    for(int y = bounds.y0; y < bounds.y1; y++){
+        for(int x = bounds.x0; x < bounds.x1; x++){
+            currentCells[get_index(x - bounds.x0, y - bounds.y0)] = (state(x, y) == Cell::ALIVE) ? 1 : 0;
+        }
+    }
+}
+
+/**
+ * DistributedWorld::get_local_state()
+ *
+ * Copy this rank's subdomain out to a grid.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A grid the size of this rank's subdomain.
+ */
+Grid DistributedWorld::get_local_state() const{
+    Grid state(bounds.x1 - bounds.x0, bounds.y1 - bounds.y0);
+    for(int y = 0; y < state.get_height(); y++){
+        for(int x = 0; x < state.get_width(); x++){
+            if(currentCells[get_index(x, y)]){
+                state(x, y) = Cell::ALIVE;
+            }
+        }
+    }
+    return state;
+}
+
+/**
+ * DistributedWorld::gather(root)
+ *
+ * Gather the whole world to one rank. Every rank must call it at the same point.
+ *
+ * @example
+ *
+ *      // Check the world after 100 steps on rank 0
+ *      world.advance(100);
+ *      Grid whole = world.gather();
+ *      if(world.get_rank() == 0){
+ *          std::cout << whole.get_alive_cells() << std::endl;
+ *      }
+ *
+ * @param root
+ *      Optional parameter. The rank to gather to. Defaults to 0.
+ *
+ * @return
+ *      The whole world on the root rank, and an empty grid on every other rank.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the root is not one of the ranks.
+ */
+Grid DistributedWorld::gather(int root){
+    //exception
+    if(root < 0 || root >= transport->get_ranks()){
+        throw std::runtime_error("root not within the ranks");
+    }
+    if(transport->get_rank() != root){
+        //send the subdomain a row at a time, 8 cells to a byte
+        std::vector<std::uint8_t> message;
+        for(int y = 0; y < bounds.y1 - bounds.y0; y++){
+            for(int x = 0; x < bounds.x1 - bounds.x0; x += 8){
+                std::uint8_t byte = 0;
+                for(int bit = 0; bit < 8 && x + bit < bounds.x1 - bounds.x0; bit++){
+                    byte |= std::uint8_t(currentCells[get_index(x + bit, y)] << bit);
+                }
+                message.push_back(byte);
+            }
+        }
+        transport->send(root, message);
+        return Grid();
+    }
+
+    Grid whole(width, height);
+    for(int rank = 0; rank < transport->get_ranks(); rank++){
+        Bounds part = get_subdomain(rank);
+        int partWidth = part.x1 - part.x0;
+        if(rank == root){
+            whole.merge(get_local_state(), part.x0, part.y0);
+            continue;
+        }
+        std::vector<std::uint8_t> message = transport->receive(rank);
+        std::size_t rowBytes = std::size_t((partWidth + 7) / 8);
+        //exception
+        if(message.size() != rowBytes * std::size_t(part.y1 - part.y0)){
+            throw std::runtime_error("gathered subdomain has the wrong size");
+        }
+        for(int y = part.y0; y < part.y1; y++){
+            for(int x = 0; x < partWidth; x++){
+                if((message[(rowBytes * (y - part.y0)) + (x / 8)] >> (x % 8)) & 1){
+                    whole(part.x0 + x, y) = Cell::ALIVE;
+                }
+            }
+        }
+    }
+    return whole;
+}
+
+/**
+ * DistributedWorld::step()
+ *
+ * Update the world one generation. Every rank must step together.
+ * Should be implemented by sending this rank's edges to its neighbours, stepping the cells away from the edges
+ * with DistributedWorld::step_cells while they are on their way, then receiving the halo and stepping the rest.
+ */
+void DistributedWorld::step(){
+    int self = transport->get_rank();
+    int localWidth = bounds.x1 - bounds.x0;
+    int localHeight = bounds.y1 - bounds.y0;
+
+    //list the neighbour in each direction and each neighbouring rank once
+    int neighbours[8];
+    std::vector<int> peers;
+    for(int direction = 0; direction < 8; direction++){
+        neighbours[direction] = get_neighbour(direction);
+        if(neighbours[direction] >= 0 &&
+           std::find(peers.begin(), peers.end(), neighbours[direction]) == peers.end()){
+            peers.push_back(neighbours[direction]);
+        }
+    }
+
+    //send every edge going to the same rank as one message, keeping the one to this rank
+    std::vector<std::uint8_t> own;
+    for(int peer : peers){
+        std::vector<std::uint8_t> message;
+        for(int direction = 0; direction < 8; direction++){
+            if(neighbours[direction] == peer){
+                pack_edge(direction, message);
+            }
+        }
+        if(peer == self){
+            own = message;
+        }
+        else{
+            transport->send(peer, message);
+        }
+    }
+
+    //step the cells away from the edges while the halo is on its way
+    if(localWidth > 2 && localHeight > 2){
+        step_cells(1, 1, localWidth - 1, localHeight - 1);
+    }
+
+    //an edge a peer sent facing direction d fills the halo on the opposite side, beyond the world it is fixed
+    for(int peer : peers){
+        std::vector<std::uint8_t> message = (peer == self) ? own : transport->receive(peer);
+        std::size_t offset = 0;
+        for(int direction = 0; direction < 8; direction++){
+            if(neighbours[direction ^ 1] == peer){
+                offset = unpack_edge(direction ^ 1, message, offset);
+            }
+        }
+    }
+    std::uint8_t beyond = (topology == Topology::BOUNDARY_ALIVE) ? 1 : 0;
+    for(int direction = 0; direction < 8; direction++){
+        if(neighbours[direction] < 0){
+            int count = DX[direction] == 0 ? localWidth : (DY[direction] == 0 ? localHeight : 1);
+            unpack_edge(direction, std::vector<std::uint8_t>(std::size_t((count + 7) / 8), beyond ? 0xFF : 0), 0);
+        }
+    }
+
+    //step the ring of cells along the edges
+    step_cells(0, 0, localWidth, 1);
+    if(localHeight > 1){
+        step_cells(0, localHeight - 1, localWidth, localHeight);
+    }
+    if(localHeight > 2){
+        step_cells(0, 1, 1, localHeight - 1);
+        if(localWidth > 1){
+            step_cells(localWidth - 1, 1, localWidth, localHeight - 1);
+        }
+    }
+
+    std::swap(currentCells, nextCells);
+    generation++;
+}
+
+/**
+ * DistributedWorld::advance(steps)
+ *
+ * Update the world a number of generations. Every rank must advance together.
+ *
+ * @param steps
+ *      The number of generations to step.
+ */
+void DistributedWorld::advance(int steps){
+    for(int i = 0; i < steps; i++){
+        step();
+    }
+}
@@ -0,0 +1,66 @@
+/**
+ * Declares a class representing one process's part of a world split across several processes.
+ * Rich documentation for the api and behaviour the DistributedWorld class can be found in distributed_world.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+#include "world.h"
+#include "transport.h"
+#include <cstdint>
+#include <vector>
+
+/**
+ * Declare the structure of the DistributedWorld class for stepping the part of a world owned by one rank.
+ *
+ * The world is split into a grid of columns x rows subdomains, one per rank. Each rank holds its subdomain padded
+ * with a one cell halo, as bytes of 0 or 1, swapping the current and next buffers after each update step.
+ */
+class DistributedWorld {
+    private:
+        int width;
+        int height;
+        int columns;
+        int rows;
+        Bounds bounds;
+        Topology topology;
+        Rule rule;
+        int generation;
+        Transport* transport;
+        std::vector<std::uint8_t> currentCells;
+        std::vector<std::uint8_t> nextCells;
+
+        int get_index(int x, int y) const;
+        Bounds get_subdomain(int rank) const;
+        int get_neighbour(int direction) const;
+        void pack_edge(int direction, std::vector<std::uint8_t>& message) const;
+        std::size_t unpack_edge(int direction, const std::vector<std::uint8_t>& message, std::size_t offset);
+        void step_cells(int x0, int y0, int x1, int y1);
+
+    public:
+        DistributedWorld(int width, int height, int columns, int rows, Transport& transport,
+                         Topology topology = Topology::PLANE);
+
+        int get_width() const;
+        int get_height() const;
+        int get_rank() const;
+        Bounds get_bounds() const;
+        int get_generation() const;
+        int get_alive_cells() const;
+
+        const Rule& get_rule() const;
+        void set_rule(Rule new_rule);
+
+        void set_state(const Grid& state);
+        Grid get_local_state() const;
+        Grid gather(int root = 0);
+
+        void step();
+        void advance(int steps);
+};
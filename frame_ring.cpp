@@ -0,0 +1,445 @@
+/**
+ * Implements the FramePublisher and FrameReader classes for sharing live world frames with other processes.
+ *      - A FramePublisher creates a named POSIX shared memory segment holding a ring of frame slots, and writes each
+ *        frame it is given into the next slot, packed 64 cells to a word with Grid::pack_row.
+ *          - Publishing never waits for readers, and readers never write to the segment, so any number of viewers
+ *            can come and go without slowing the simulation down.
+ *
+ *      - Each slot is guarded by a sequence counter, in the style of a seqlock.
+ *          - The publisher makes the counter odd before writing a slot and even again once it has finished.
+ *          - A reader notes the counter, reads the slot in place, then checks the counter again. If the counter was
+ *            odd or has moved on, the publisher wrote over the slot while it was being read, so the reader tries
+ *            again with the latest frame.
+ *          - The number of frames published so far is kept on its own line, so readers can find the latest slot.
+ *
+ *      - A FrameReader maps the segment read only and checks that it holds frames.
+ *          - FrameReader::latest and FrameReader::is_valid give a view of the latest frame without copying it.
+ *          - FrameReader::read copies the latest whole frame into a grid.
+ *
+ * The segment starts with a header line giving its magic number, layout version, width, height, number of slots and
+ * words per row, then a line holding the number of frames published. Each slot is a line holding its sequence counter
+ * and the frame's generation, then the packed rows.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "frame_ring.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//the header, the published count and the start of each slot are each on their own line
+static const std::size_t LINE = 64;
+static const std::uint32_t MAGIC = 0x464C4F47;
+static const std::uint32_t VERSION = 1;
+
+namespace {
+
+/**
+ * Header
+ *
+ * The first line of the segment, written once by the publisher before any frame.
+ */
+struct Header {
+    std::uint32_t magic;
+    std::uint32_t version;
+    std::int32_t width;
+    std::int32_t height;
+    std::int32_t slots;
+    std::int32_t rowWords;
+    std::uint64_t slotBytes;
+};
+
+}
+
+/**
+ * get_slot_bytes(height, rowWords)
+ *
+ * Helper to get the number of bytes in a slot, which is a line for its counter and generation then the packed rows,
+ * rounded up to a whole number of lines.
+ */
+static std::size_t get_slot_bytes(int height, int rowWords){
+    std::size_t bytes = LINE + (std::size_t(height) * rowWords * sizeof(std::uint64_t));
+    return ((bytes + LINE - 1) / LINE) * LINE;
+}
+
+/**
+ * FramePublisher::FramePublisher(name, width, height, slots)
+ *
+ * Create a shared memory ring for publishing frames of a world of the given size. A segment with the same name left
+ * from an earlier run is replaced; readers that still have it mapped keep the old one.
+ *
+ * @example
+ *
+ *      // Publish frames of a 1000 x 1000 world in a ring of 8 slots
+ *      FramePublisher publisher("/life_frames", 1000, 1000);
+ *
+ * @param name
+ *      The name of the shared memory segment, starting with a '/'.
+ *
+ * @param width
+ *      The width of the frames.
+ *
+ * @param height
+ *      The height of the frames.
+ *
+ * @param slots
+ *      Optional parameter. The number of frames in the ring, which gives slow readers longer before the slot they
+ *      are reading is written over. Defaults to 8.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The width or height is not positive, or there are fewer than 2 slots.
+ *          - The segment cannot be created or mapped.
+ */
+FramePublisher::FramePublisher(std::string name, int width, int height, int slots){
+    //exception
+    if(width <= 0 || height <= 0 || slots < 2){
+        throw std::runtime_error("frames must have an area and the ring at least 2 slots");
+    }
+    this->name = name;
+    this->width = width;
+    this->height = height;
+    this->slots = slots;
+    this->rowWords = (width + 63) / 64;
+    this->slotBytes = get_slot_bytes(height, rowWords);
+    this->size = (2 * LINE) + (std::size_t(slots) * slotBytes);
+    this->memory = nullptr;
+    this->published = 0;
+
+    shm_unlink(name.c_str());
+    int descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    //exception
+    if(descriptor < 0 || ftruncate(descriptor, off_t(size)) != 0){
+        if(descriptor >= 0){
+            close(descriptor);
+            shm_unlink(name.c_str());
+        }
+        throw std::runtime_error("can't create shared memory " + name);
+    }
+    void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    //exception
+    if(mapped == MAP_FAILED){
+        shm_unlink(name.c_str());
+        throw std::runtime_error("can't map shared memory " + name);
+    }
+    memory = static_cast<std::uint8_t*>(mapped);
+
+    //a new segment is all zeros, which is no frames published and every slot free, so only the header is written
+    Header header = {0, VERSION, width, height, slots, rowWords, slotBytes};
+    *reinterpret_cast<Header*>(memory) = header;
+    reinterpret_cast<std::atomic<std::uint32_t>*>(memory)->store(MAGIC, std::memory_order_release);
+}
+
+/**
+ * FramePublisher::~FramePublisher()
+ *
+ * Unmap the segment and remove its name, so it is gone once every reader has unmapped it.
+ */
+FramePublisher::~FramePublisher(){
+    munmap(memory, size);
+    shm_unlink(name.c_str());
+}
+
+/**
+ * FramePublisher::get_width()
+ *
+ * Gets the width of the frames.
+ * The function should be callable from a constant context.
+ */
+int FramePublisher::get_width() const{
+    return width;
+}
+
+/**
+ * FramePublisher::get_height()
+ *
+ * Gets the height of the frames.
+ * The function should be callable from a constant context.
+ */
+int FramePublisher::get_height() const{
+    return height;
+}
+
+/**
+ * FramePublisher::get_published()
+ *
+ * Gets the number of frames published so far.
+ * The function should be callable from a constant context.
+ */
+long long FramePublisher::get_published() const{
+    return published;
+}
+
+/**
+ * FramePublisher::publish(grid, generation)
+ *
+ * Write a frame into the next slot of the ring and make it the latest. This never waits for readers.
+ *
+ * @example
+ *
+ *      // Publish every generation of a world
+ *      FramePublisher publisher("/life_frames", world.get_width(), world.get_height());
+ *      world.step();
+ *      publisher.publish(world.get_state(), world.get_generation());
+ *
+ * @param grid
+ *      The frame to publish, which must be the size given to the constructor.
+ *
+ * @param generation
+ *      The generation of the world the frame shows.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the grid is not the size of the frames.
+ */
+void FramePublisher::publish(const Grid& grid, long long generation){
+    //exception
+    if(grid.get_width() != width || grid.get_height() != height){
+        throw std::runtime_error("grid is not the size of the frames");
+    }
+    std::uint8_t* slot = memory + (2 * LINE) + (std::size_t(published % slots) * slotBytes);
+    std::atomic<std::uint64_t>* sequence = reinterpret_cast<std::atomic<std::uint64_t>*>(slot);
+    std::uint64_t* words = reinterpret_cast<std::uint64_t*>(slot + LINE);
+
+    //make the counter odd, and keep the writes to the slot after it
+    std::uint64_t start = sequence->load(std::memory_order_relaxed);
+    sequence->store(start + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    *reinterpret_cast<std::int64_t*>(slot + sizeof(std::uint64_t)) = generation;
+    for(int y = 0; y < height; y++){
+        grid.pack_row(y, words + (std::size_t(y) * rowWords));
+    }
+
+    //make the counter even again, then point readers at the slot
+    sequence->store(start + 2, std::memory_order_release);
+    published++;
+    reinterpret_cast<std::atomic<std::uint64_t>*>(memory + LINE)->store(published, std::memory_order_release);
+}
+
+/**
+ * FrameReader::FrameReader(name)
+ *
+ * Map a FramePublisher's ring read only.
+ *
+ * @example
+ *
+ *      // Watch the frames of another process
+ *      FrameReader reader("/life_frames");
+ *
+ * @param name
+ *      The name of the shared memory segment given to the FramePublisher.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - There is no segment with the name, or it cannot be mapped.
+ *          - The segment does not hold a ring of frames of this layout.
+ */
+FrameReader::FrameReader(std::string name){
+    int descriptor = shm_open(name.c_str(), O_RDONLY, 0);
+    struct stat status;
+    //exception
+    if(descriptor < 0 || fstat(descriptor, &status) != 0 || std::size_t(status.st_size) < 2 * LINE){
+        if(descriptor >= 0){
+            close(descriptor);
+        }
+        throw std::runtime_error("can't open shared memory " + name);
+    }
+    this->size = std::size_t(status.st_size);
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    //exception
+    if(mapped == MAP_FAILED){
+        throw std::runtime_error("can't map shared memory " + name);
+    }
+    memory = static_cast<const std::uint8_t*>(mapped);
+
+    //the magic number is stored last, so a header with it is complete
+    const Header* header = reinterpret_cast<const Header*>(memory);
+    const std::atomic<std::uint32_t>* magic = reinterpret_cast<const std::atomic<std::uint32_t>*>(memory);
+    bool complete = magic->load(std::memory_order_acquire) == MAGIC;
+    this->width = header->width;
+    this->height = header->height;
+    this->slots = header->slots;
+    this->rowWords = header->rowWords;
+    this->slotBytes = std::size_t(header->slotBytes);
+    //exception
+    if(!complete || header->version != VERSION || width <= 0 || height <= 0 || slots < 2 ||
+       rowWords != (width + 63) / 64 || slotBytes != get_slot_bytes(height, rowWords) ||
+       size < (2 * LINE) + (std::size_t(slots) * slotBytes)){
+        munmap(const_cast<std::uint8_t*>(memory), size);
+        throw std::runtime_error("shared memory " + name + " does not hold frames");
+    }
+}
+
+/**
+ * FrameReader::~FrameReader()
+ *
+ * Unmap the segment.
+ */
+FrameReader::~FrameReader(){
+    munmap(const_cast<std::uint8_t*>(memory), size);
+}
+
+/**
+ * FrameReader::get_width()
+ *
+ * Gets the width of the frames.
+ * The function should be callable from a constant context.
+ */
+int FrameReader::get_width() const{
+    return width;
+}
+
+/**
+ * FrameReader::get_height()
+ *
+ * Gets the height of the frames.
+ * The function should be callable from a constant context.
+ */
+int FrameReader::get_height() const{
+    return height;
+}
+
+/**
+ * FrameReader::get_published()
+ *
+ * Gets the number of frames published so far, which is 0 until the first frame is.
+ * The function should be callable from a constant context.
+ */
+long long FrameReader::get_published() const{
+    return static_cast<long long>(
+        reinterpret_cast<const std::atomic<std::uint64_t>*>(memory + LINE)->load(std::memory_order_acquire));
+}
+
+/**
+ * FrameReader::latest(frame)
+ *
+ * Gets a view of the latest frame, read in place from the shared memory. The view must be checked with
+ * FrameReader::is_valid once it has been read, since the publisher may have written over it in the meantime.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Count the live cells of the latest frame without copying it
+ *      Frame frame;
+ *      int alive;
+ *      do{
+ *          alive = 0;
+ *          reader.latest(frame);
+ *          for(int i = 0; i < frame.height * frame.rowWords; i++){
+ *              alive += __builtin_popcountll(frame.words[i]);
+ *          }
+ *      } while(!reader.is_valid(frame));
+ *
+ * @param frame
+ *      The frame to point at the latest slot.
+ *
+ * @return
+ *      False if no frame has been published yet, otherwise true.
+ */
+bool FrameReader::latest(Frame& frame) const{
+    const std::atomic<std::uint64_t>* count = reinterpret_cast<const std::atomic<std::uint64_t>*>(memory + LINE);
+
+    //loop that waits out a publisher part way through writing the latest slot
+    while(true){
+        std::uint64_t number = count->load(std::memory_order_acquire);
+        if(number == 0){
+            return false;
+        }
+        int slot = int((number - 1) % std::uint64_t(slots));
+        const std::uint8_t* start = memory + (2 * LINE) + (std::size_t(slot) * slotBytes);
+        std::uint64_t sequence = reinterpret_cast<const std::atomic<std::uint64_t>*>(start)->load(
+            std::memory_order_acquire);
+        if((sequence & 1) == 1){
+            std::this_thread::yield();
+            continue;
+        }
+        frame.number = static_cast<long long>(number);
+        frame.generation = *reinterpret_cast<const volatile std::int64_t*>(start + sizeof(std::uint64_t));
+        frame.sequence = sequence;
+        frame.slot = slot;
+        frame.width = width;
+        frame.height = height;
+        frame.rowWords = rowWords;
+        frame.words = reinterpret_cast<const std::uint64_t*>(start + LINE);
+        return true;
+    }
+}
+
+/**
+ * FrameReader::is_valid(frame)
+ *
+ * Checks that the publisher has not started writing over a frame since FrameReader::latest gave it, so everything
+ * read from it before the check is one whole frame.
+ * The function should be callable from a constant context.
+ *
+ * @param frame
+ *      A frame given by FrameReader::latest.
+ *
+ * @return
+ *      True if the frame was not written over while it was being read, otherwise false.
+ */
+bool FrameReader::is_valid(const Frame& frame) const{
+    const std::uint8_t* start = memory + (2 * LINE) + (std::size_t(frame.slot) * slotBytes);
+
+    //keep the reads of the frame before the second look at the counter
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return reinterpret_cast<const std::atomic<std::uint64_t>*>(start)->load(std::memory_order_relaxed) ==
+           frame.sequence;
+}
+
+/**
+ * FrameReader::read(grid, generation)
+ *
+ * Copies the latest whole frame into a grid, trying again with a newer frame whenever the publisher writes over the
+ * one being copied.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Print the latest frame
+ *      Grid grid;
+ *      long long generation;
+ *      if(reader.read(grid, generation)){
+ *          std::cout << "Generation " << generation << "\n" << grid;
+ *      }
+ *
+ * @param grid
+ *      The grid to copy the frame into, which is resized to the frames if needed.
+ *
+ * @param generation
+ *      Set to the generation of the world the frame shows.
+ *
+ * @return
+ *      False if no frame has been published yet, otherwise true.
+ */
+bool FrameReader::read(Grid& grid, long long& generation) const{
+    if(grid.get_width() != width || grid.get_height() != height){
+        grid = Grid(width, height);
+    }
+    Frame frame;
+    do{
+        if(!latest(frame)){
+            return false;
+        }
+        //nested loops that unpack each row straight into the grid's cells
+        for(int y = 0; y < height; y++){
+            const std::uint64_t* words = frame.words + (std::size_t(y) * rowWords);
+            Cell* row = &grid(0, y);
+            for(int x = 0; x < width; x++){
+                row[x] = ((words[x / 64] >> (x % 64)) & 1) ? Cell::ALIVE : Cell::DEAD;
+            }
+        }
+        generation = frame.generation;
+    } while(!is_valid(frame));
+    return true;
+}
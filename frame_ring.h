@@ -0,0 +1,86 @@
+/**
+ * Declares the FramePublisher and FrameReader classes for sharing live world frames with other processes.
+ * Rich documentation for the api and behaviour the classes can be found in frame_ring.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * A Frame is a view of one published generation, read in place from the shared memory of a FrameReader.
+ *      - number counts the frames published, from 1, and generation is the generation of the world it shows.
+ *      - Cell (x, y) is bit x % 64 of words[y * rowWords + x / 64].
+ *      - The view is only good while FrameReader::is_valid says so, since the publisher reuses its slot later.
+ */
+struct Frame {
+    long long number;
+    long long generation;
+    std::uint64_t sequence;
+    int slot;
+    int width;
+    int height;
+    int rowWords;
+    const std::uint64_t* words;
+};
+
+/**
+ * Declare the structure of the FramePublisher class, which writes frames into a named POSIX shared memory ring.
+ */
+class FramePublisher {
+    private:
+        std::string name;
+        int width;
+        int height;
+        int slots;
+        int rowWords;
+        std::size_t slotBytes;
+        std::size_t size;
+        std::uint8_t* memory;
+        long long published;
+
+    public:
+        FramePublisher(std::string name, int width, int height, int slots = 8);
+        ~FramePublisher();
+        FramePublisher(const FramePublisher&) = delete;
+        FramePublisher& operator=(const FramePublisher&) = delete;
+
+        int get_width() const;
+        int get_height() const;
+        long long get_published() const;
+        void publish(const Grid& grid, long long generation);
+};
+
+/**
+ * Declare the structure of the FrameReader class, which maps a FramePublisher's ring read only.
+ */
+class FrameReader {
+    private:
+        int width;
+        int height;
+        int slots;
+        int rowWords;
+        std::size_t slotBytes;
+        std::size_t size;
+        const std::uint8_t* memory;
+
+    public:
+        explicit FrameReader(std::string name);
+        ~FrameReader();
+        FrameReader(const FrameReader&) = delete;
+        FrameReader& operator=(const FrameReader&) = delete;
+
+        int get_width() const;
+        int get_height() const;
+        long long get_published() const;
+        bool latest(Frame& frame) const;
+        bool is_valid(const Frame& frame) const;
+        bool read(Grid& grid, long long& generation) const;
+};
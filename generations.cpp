@@ -0,0 +1,235 @@
+/**
+ * Implements a class representing a 2d grid world for simulating Generations cellular automata.
+ *      - Generations rules extend Life-like rules with dying states, e.g. Brian's Brain (B2/S/C3).
+ *          - https://www.conwaylife.com/wiki/Generations
+ *          - The meaning of each state is documented with Rule::get_next_state(state, neighbours).
+ *
+ *      - Cells are stored in a StateGrid at half a byte per cell.
+ *          - Stepping unpacks the three rows around each row to a byte per cell, counts the alive
+ *            neighbours of every cell, and packs the new row back down.
+ *          - The rule is expanded into a lookup table indexed by the state and neighbour count before stepping.
+ *
+ *      - Updating the world state can conditionally be performed using a toroidal topology, as with World.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "generations.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * GenerationsWorld::GenerationsWorld(initial_state, rule)
+ *
+ * Construct a world using the size and states of an existing grid, simulated with a Generations rule.
+ *
+ * @example
+ *
+ *      // Make Brian's Brain from a random two state grid
+ *      GenerationsWorld world(StateGrid(Zoo::load_ascii("path/to/soup.gol")), Rule("B2/S/C3"));
+ *
+ * @param initial_state
+ *      The state of the constructed world.
+ *
+ * @param rule
+ *      The rule to simulate with. Life-like rules with two states work too.
+ *
+ * @throws
+ *      std::exception or sub-class if the initial state uses a state the rule does not have,
+ *      or the rule is not totalistic.
+ */
+GenerationsWorld::GenerationsWorld(StateGrid initial_state, Rule rule){
+    this->width = initial_state.get_width();
+    this->height = initial_state.get_height();
+    this->rule = rule;
+    this->generation = 0;
+
+    //exception
+    if(!rule.is_totalistic()){
+        throw std::runtime_error("Generations rules must be totalistic");
+    }
+    //exception
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            if(initial_state.get(x, y) >= rule.get_states()){
+                throw std::runtime_error("state not in rule");
+            }
+        }
+    }
+    currentGrid = initial_state;
+    nextGrid = StateGrid(width, height);
+}
+
+/**
+ * GenerationsWorld::get_width()
+ *
+ * Gets the current width of the world.
+ *
+ * @return
+ *      The width of the world.
+ */
+int GenerationsWorld::get_width(){
+    return this->width;
+}
+
+/**
+ * GenerationsWorld::get_height()
+ *
+ * Gets the current height of the world.
+ *
+ * @return
+ *      The height of the world.
+ */
+int GenerationsWorld::get_height(){
+    return this->height;
+}
+
+/**
+ * GenerationsWorld::get_total_cells()
+ *
+ * Gets the total number of cells in the world.
+ *
+ * @return
+ *      The number of total cells.
+ */
+int GenerationsWorld::get_total_cells(){
+    return (this->height * this->width);
+}
+
+/**
+ * GenerationsWorld::get_alive_cells()
+ *
+ * Counts how many cells in the world are alive (state 1). Dying cells are not counted.
+ *
+ * @return
+ *      The number of alive cells.
+ */
+int GenerationsWorld::get_alive_cells(){
+    return currentGrid.get_alive_cells();
+}
+
+/**
+ * GenerationsWorld::get_generation()
+ *
+ * Gets the number of steps the world has taken since it was constructed.
+ *
+ * @return
+ *      The current generation number.
+ */
+int GenerationsWorld::get_generation(){
+    return generation;
+}
+
+/**
+ * GenerationsWorld::get_state()
+ *
+ * Return a read-only reference to the current state, without copying it.
+ *
+ * @return
+ *      A reference to the current state.
+ */
+const StateGrid& GenerationsWorld::get_state(){
+    return currentGrid;
+}
+
+/**
+ * GenerationsWorld::get_rule()
+ *
+ * Gets the rule the world is simulated with.
+ *
+ * @return
+ *      A read-only reference to the rule.
+ */
+const Rule& GenerationsWorld::get_rule(){
+    return rule;
+}
+
+/**
+ * GenerationsWorld::step(toroidal)
+ *
+ * Take one step in the world's Generations rule.
+ *
+ * Reads from the current state grid and writes to the next state grid. Then swaps the grids.
+ * Only alive (state 1) cells are counted as neighbours. Dying cells age by one state whatever their neighbours.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then the step will consider the grid as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom. Defaults to false.
+ */
+void GenerationsWorld::step(bool toroidal){
+    //table of the next state for each state (in steps of 9) and neighbour count
+    std::vector<std::uint8_t> table(16 * 9, 0);
+    for(int state = 0; state < rule.get_states(); state++){
+        for(int n = 0; n <= 8; n++){
+            table[(state * 9) + n] = std::uint8_t(rule.get_next_state(state, n));
+        }
+    }
+
+    /*the rows above, on and below the current row, unpacked with a one cell halo on each side
+    and then reduced to 1 for alive cells and 0 for every other state*/
+    std::vector<std::uint8_t> states(width);
+    std::vector<std::uint8_t> alive[3];
+    for(int r = 0; r < 3; r++){
+        alive[r].assign(width + 2, 0);
+    }
+    std::vector<std::uint8_t> next(width);
+
+    //nested loops that compute each row of the next state
+    for(int y = 0; y < height; y++){
+        for(int r = 0; r < 3; r++){
+            int row = y - 1 + r;
+            if(toroidal){
+                row = (row + height) % height;
+            }
+            std::fill(alive[r].begin(), alive[r].end(), 0);
+            if(row < 0 || row >= height){
+                continue;
+            }
+            currentGrid.unpack_row(row, alive[r].data() + 1);
+            for(int x = 1; x <= width; x++){
+                alive[r][x] = (alive[r][x] == 1);
+            }
+            if(toroidal){
+                alive[r][0] = alive[r][width];
+                alive[r][width + 1] = alive[r][1];
+            }
+        }
+        currentGrid.unpack_row(y, states.data());
+
+        for(int x = 0; x < width; x++){
+            int n = alive[0][x] + alive[0][x + 1] + alive[0][x + 2] +
+                    alive[1][x] +                    alive[1][x + 2] +
+                    alive[2][x] + alive[2][x + 1] + alive[2][x + 2];
+            next[x] = table[(states[x] * 9) + n];
+        }
+        nextGrid.pack_row(y, next.data());
+    }
+
+    //take the next step
+    std::swap(currentGrid, nextGrid);
+    generation++;
+}
+
+/**
+ * GenerationsWorld::advance(steps, toroidal)
+ *
+ * Advance multiple steps in the world's Generations rule.
+ * Should be implemented by invoking GenerationsWorld::step(toroidal).
+ *
+ * @param steps
+ *      The number of steps to advance the world forward.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then the step will consider the grid as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom. Defaults to false.
+ */
+void GenerationsWorld::advance(int steps, bool toroidal){
+    //change world the number of steps
+    for(int i = 0; i < steps; i++){
+        step(toroidal);
+    }
+}
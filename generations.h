@@ -0,0 +1,44 @@
+/**
+ * Declares a class representing a 2d grid world for simulating Generations cellular automata.
+ * Rich documentation for the api and behaviour the GenerationsWorld class can be found in generations.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "state_grid.h"
+#include "rule.h"
+
+/**
+ * Declare the structure of the GenerationsWorld class for representing a 2d grid world of multi-state cells.
+ *
+ * Like World, a GenerationsWorld holds two equally sized StateGrid objects for the current state and next state,
+ * swapped using std::swap after each update step.
+ */
+class GenerationsWorld {
+    private:
+        int width;
+        int height;
+        StateGrid currentGrid;
+        StateGrid nextGrid;
+        Rule rule;
+        int generation;
+
+    public:
+        GenerationsWorld(StateGrid initial_state, Rule rule);
+
+        int get_width();
+        int get_height();
+        int get_total_cells();
+        int get_alive_cells();
+        int get_generation();
+
+        const StateGrid& get_state();
+        const Rule& get_rule();
+
+        void step(bool toroidal = false);
+        void advance(int steps, bool toroidal = false);
+};
@@ -2,7 +2,9 @@
  * Implements a class representing a 2d grid of cells.
  *      - New cells are initialized to Cell::DEAD.
  *      - Grids can be resized while retaining their contents in the remaining area.
- *      - Grids can be rotated, cropped, and merged together.
+ *      - Grids can be rotated, reflected, cropped, and merged together.
+ *      - Grid rows can be packed into 64 bit words, one bit per cell, for bitwise processing.
+ *      - Grids can be hashed and compared for equality, so they can be used as keys in hash maps.
  *      - Grids can return counts of the alive and dead cells.
  *      - Grids can be serialized directly to an ascii std::ostream.
  *
@@ -13,9 +15,104 @@
  */
 #include "grid.h"
 #include <iostream>
+#include <algorithm>
+#include <cstring>
 
 // Include the minimal number of headers needed to support your implementation.
 // #include ...
+#include <sys/mman.h>
+
+//blocks of cells this big or bigger are mapped on their own, aligned so they can be backed by huge pages
+static const std::size_t HUGE_PAGE = std::size_t(1) << 21;
+
+//the memory resource new grids made on this thread take their cells from, or nullptr for allocate_cells(bytes)
+static thread_local std::pmr::memory_resource* cellResource = nullptr;
+
+/**
+ * get_cell_resource()
+ *
+ * Gets the memory resource that grids made on the calling thread take their cells from, see GridArena.
+ *
+ * @return
+ *      The memory resource, or nullptr if grids use allocate_cells(bytes).
+ */
+std::pmr::memory_resource* get_cell_resource(){
+    return cellResource;
+}
+
+/**
+ * set_cell_resource(resource)
+ *
+ * Sets the memory resource that grids made on the calling thread from now on take their cells from. Grids keep the
+ * resource they were made with for their whole life, so it must outlive them. Copies of a grid take their cells from
+ * the resource of the thread making the copy, which lets results be copied out of a short-lived arena.
+ * ArenaScope sets and restores this for a block of code.
+ *
+ * @param resource
+ *      The memory resource, or nullptr to go back to allocate_cells(bytes).
+ *
+ * @return
+ *      The resource that was set before.
+ */
+std::pmr::memory_resource* set_cell_resource(std::pmr::memory_resource* resource){
+    std::pmr::memory_resource* previous = cellResource;
+    cellResource = resource;
+    return previous;
+}
+
+/**
+ * allocate_cells(bytes)
+ *
+ * Allocates the storage for a CellAllocator. Small blocks come from operator new. Blocks of a huge page or more are
+ * mapped straight from the operating system, rounded up to a whole number of huge pages and aligned to one, so:
+ *      - None of their pages are touched until they are first written, and on NUMA machines each page is placed on
+ *        the node of the thread that first writes it.
+ *      - They can be backed by transparent huge pages, see World::set_threads(threads, pinned, huge_pages).
+ *
+ * @param bytes
+ *      The number of bytes to allocate.
+ *
+ * @return
+ *      Pointer to the block, which must be given back to free_cells(cells, bytes) with the same number of bytes.
+ *
+ * @throws
+ *      std::bad_alloc if the block cannot be allocated.
+ */
+void* allocate_cells(std::size_t bytes){
+    if(bytes < HUGE_PAGE){
+        return ::operator new(bytes);
+    }
+    std::size_t size = ((bytes + HUGE_PAGE - 1) / HUGE_PAGE) * HUGE_PAGE;
+    void* mapped = mmap(nullptr, size + HUGE_PAGE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    //exception
+    if(mapped == MAP_FAILED){
+        throw std::bad_alloc();
+    }
+
+    //trim the extra huge page from either side of the aligned block
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(mapped);
+    std::uintptr_t aligned = (start + HUGE_PAGE - 1) & ~(std::uintptr_t(HUGE_PAGE) - 1);
+    if(aligned > start){
+        munmap(mapped, aligned - start);
+    }
+    if(start + HUGE_PAGE > aligned){
+        munmap(reinterpret_cast<void*>(aligned + size), start + HUGE_PAGE - aligned);
+    }
+    return reinterpret_cast<void*>(aligned);
+}
+
+/**
+ * free_cells(cells, bytes)
+ *
+ * Frees a block given by allocate_cells(bytes).
+ */
+void free_cells(void* cells, std::size_t bytes){
+    if(bytes < HUGE_PAGE){
+        ::operator delete(cells);
+        return;
+    }
+    munmap(cells, ((bytes + HUGE_PAGE - 1) / HUGE_PAGE) * HUGE_PAGE);
+}
 
 /**
  * Grid::Grid()
@@ -61,9 +158,9 @@ Grid::Grid(int square_size){
     this->width = square_size;
     this->height = square_size;
 
-    //loop fills grid with the needed amount of dead cells
-    for (int i = 0; i < (height*width); i++) {
-        gridCells.push_back(Cell::DEAD);
+    //fill the grid with the needed amount of dead cells in one allocation
+    if (width > 0 && height > 0) {
+        gridCells.assign(std::size_t(width) * height, Cell::DEAD);
     }
 }
 
@@ -87,12 +184,49 @@ Grid::Grid(int width, int height){
     this->width = width;
     this->height = height;
 
-    //loop fills grid with the needed amount of dead cells
-    for (int i = 0; i < (height*width); i++) {
-        gridCells.push_back(Cell::DEAD);
+    //fill the grid with the needed amount of dead cells in one allocation
+    if (width > 0 && height > 0) {
+        gridCells.assign(std::size_t(width) * height, Cell::DEAD);
     }
 }
 
+/**
+ * Grid::Grid(other)
+ *
+ * Construct a grid by moving the cells out of another, leaving it an empty grid of size 0x0.
+ *
+ * The cells are taken over without copying if they come from the memory resource set for the calling thread, such
+ * as the GridArena of an ArenaScope, or if both use allocate_cells(bytes). Otherwise they are copied into memory from
+ * the calling thread's resource, so the new grid never depends on an arena that may be released or destroyed before
+ * it is gone.
+ *
+ * @example
+ *
+ *      // Keep a grid made inside an arena scope after the arena is released
+ *      GridArena arena;
+ *      std::vector<Grid> made;
+ *      {
+ *          ArenaScope scope(arena);
+ *          made.push_back(Zoo::glider().rotate(1));
+ *      }
+ *      Grid kept = std::move(made.back());
+ *      made.clear();
+ *      arena.release();
+ *
+ * @param other
+ *      The grid to move.
+ */
+Grid::Grid(Grid&& other) :
+    width(other.width),
+    height(other.height),
+    gridCells(other.gridCells.get_allocator().resource == get_cell_resource() ?
+        std::move(other.gridCells) : std::vector<Cell, CellAllocator<Cell>>(other.gridCells.begin(),
+                                                                            other.gridCells.end())){
+    other.width = 0;
+    other.height = 0;
+    other.gridCells.clear();
+}
+
 /**
  * Grid::get_width()
  *
@@ -247,6 +381,50 @@ int Grid::get_dead_cells() const{
 }
 
 
+/**
+ * Grid::get_bounding_box()
+ *
+ * Finds the smallest rectangle containing every alive cell in the grid.
+ * The returned window can be passed straight to Grid::crop to trim away the dead border.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Make a grid with a glider somewhere in the middle
+ *      Grid grid(16, 16);
+ *      grid.merge(Zoo::glider(), 5, 7);
+ *
+ *      // Crop the grid down to just the glider
+ *      Bounds box = grid.get_bounding_box();
+ *      Grid glider = grid.crop(box.x0, box.y0, box.x1, box.y1);
+ *
+ * @return
+ *      The bounding box of the alive cells, or an empty Bounds of {0, 0, 0, 0} if no cells are alive.
+ */
+Bounds Grid::get_bounding_box() const{
+    Bounds box = {width, height, 0, 0};
+
+    //nested loops that grow the box around every alive cell, row by row
+    for (int y = 0; y < height; y++) {
+        const Cell* row = gridCells.data() + get_index(0, y);
+        for (int x = 0; x < width; x++) {
+            if(row[x] == Cell::ALIVE){
+                if(x < box.x0){box.x0 = x;}
+                if(x >= box.x1){box.x1 = x + 1;}
+                if(y < box.y0){box.y0 = y;}
+                box.y1 = y + 1;
+            }
+        }
+    }
+
+    //no alive cells were found
+    if(box.x0 >= box.x1){
+        box = {0, 0, 0, 0};
+    }
+    return box;
+}
+
+
 /**
  * Grid::resize(square_size)
  *
@@ -265,7 +443,7 @@ int Grid::get_dead_cells() const{
  *      The new edge size for both the width and height of the grid.
  */
 void Grid::resize(int square_size){
-    std::vector<Cell> gridCellsOld = gridCells;
+    std::vector<Cell, CellAllocator<Cell>> gridCellsOld = gridCells;
 
     int prevWidth = width;
     int prevHeight = height;
@@ -376,7 +554,7 @@ void Grid::resize(int square_size){
  *      The new height for the grid.
  */
 void Grid::resize(int w, int h){
-    std::vector<Cell> gridCellsOld = gridCells;
+    std::vector<Cell, CellAllocator<Cell>> gridCellsOld = gridCells;
 
     int prevWidth = width;
     int prevHeight = height;
@@ -466,6 +644,45 @@ void Grid::resize(int w, int h){
 }
 
 
+/**
+ * Grid::allocate(width, height)
+ *
+ * Reallocate the grid to a new width and height without writing any of its cells, which are left unset until
+ * they are written. This lets the cells of a large grid be first written, and so placed in memory, by the threads
+ * that will work on them, see World::set_threads(threads, pinned, huge_pages). Every cell must be written before
+ * it is read.
+ *
+ * @example
+ *
+ *      // Make a grid and let two threads fill a half each
+ *      Grid grid;
+ *      grid.allocate(4096, 4096);
+ *      std::thread top([&](){ std::fill_n(&grid(0, 0), 4096 * 2048, Cell::DEAD); });
+ *      std::fill_n(&grid(0, 2048), 4096 * 2048, Cell::DEAD);
+ *      top.join();
+ *
+ * @param width
+ *      The new width for the grid.
+ *
+ * @param height
+ *      The new height for the grid.
+ */
+void Grid::allocate(int width, int height){
+    this->width = width;
+    this->height = height;
+
+    //free the old storage before the new is allocated, so none of the old pages are reused
+    gridCells.clear();
+    gridCells.shrink_to_fit();
+
+    /*the cells are added by an allocator that leaves them unwritten, then moved in, which keeps the grid's own
+    allocator, so resizing the grid later still value-initialises*/
+    std::vector<Cell, CellAllocator<Cell>> cells(CellAllocator<Cell>(gridCells.get_allocator(), false));
+    cells.resize(std::size_t(width) * height);
+    gridCells = std::move(cells);
+}
+
+
 /**
  * Grid::get_index(x, y)
  *
@@ -679,7 +896,7 @@ const Cell& Grid::operator()( int x, int y)const  {
  *      std::exception or sub-class if x0,y0 or x1,y1 are not valid coordinates within the grid
  *      or if the crop window has a negative size.
  */
-Grid Grid::crop(int x0, int y0, int x1, int y1){
+Grid Grid::crop(int x0, int y0, int x1, int y1) const{
     //exception
     if(x0 > get_width() || y0 > get_height() || x0<0 || y0<0 ||
         x1 > get_width() || y1 > get_height() || x1<0 || y1<0 ){
@@ -690,17 +907,18 @@ Grid Grid::crop(int x0, int y0, int x1, int y1){
         throw std::runtime_error("not within bounds");
     }
 
-    std::vector<Cell> gridCellsOld = gridCells;
     int croppedWidth = x1-x0;
     int croppedHeight = y1-y0;
-    Grid croppedGrid = Grid(croppedWidth, croppedHeight);
+    Grid croppedGrid;
+    croppedGrid.width = croppedWidth;
+    croppedGrid.height = croppedHeight;
 
-    croppedGrid.gridCells.clear();
-
-    //nested for loops that make grid cells have the value of new cropped version
-    for (int y = y0; y < y1; y++) {
-        for (int x = x0; x < x1; x++) {
-            croppedGrid.gridCells.push_back(gridCellsOld[get_index(x, y)]);
+    //loop that copies each row of the window straight into the cropped grid, with no temporary copies
+    if (croppedWidth > 0 && croppedHeight > 0) {
+        croppedGrid.gridCells.reserve(std::size_t(croppedWidth) * croppedHeight);
+        for (int y = y0; y < y1; y++) {
+            const Cell* row = gridCells.data() + get_index(x0, y);
+            croppedGrid.gridCells.insert(croppedGrid.gridCells.end(), row, row + croppedWidth);
         }
     }
     return croppedGrid;
@@ -792,11 +1010,7 @@ void Grid::merge( Grid other, int x0, int y0, bool alive_only ){
  * @return
  *      Returns a copy of the grid that has been rotated.
  */
-Grid Grid::rotate(int rotation){
-    Grid returnGrid1;
-    Grid returnGrid2;
-    Grid returnGrid3;
-    Grid returnGridFinal;
+Grid Grid::rotate(int rotation) const{
     int times = rotation%4;
 
     /*conditional that sets the number of times the grid should rotate the minimum amount
@@ -805,42 +1019,285 @@ Grid Grid::rotate(int rotation){
         times = 4 + times;
     }
 
-    //loop that runs number of times
-    for(int i = 0; i < times; i++){
-        //conditional that checks the amount of times the grid has rotated and accordingly rotates it
-        if(i==0){
-            returnGrid1 = Grid(height, width);
-            for(int i = 0; i < returnGrid1.get_height(); i++){
-                for(int j = 0; j < returnGrid1.get_width(); j++){
-                    returnGrid1.gridCells[returnGrid1.get_index((returnGrid1.get_width() -1 -j), i)] = gridCells[get_index(i,j)];
-                }
-            }
-            returnGridFinal = returnGrid1;
-        }else if(i==1){
-            returnGrid2 = Grid(width, height);
-            for(int i = 0; i < returnGrid2.get_height(); i++){
-                for(int j = 0; j < returnGrid2.get_width(); j++){
-                    returnGrid2.gridCells[returnGrid2.get_index((returnGrid2.get_width() -1 -j),i)] = returnGrid1.gridCells[returnGrid1.get_index(i,j)];
-                }
-            }
-            returnGridFinal = returnGrid2;
-        }else if(i==2){
-            returnGrid3 = Grid(height, width);
-            for(int i = 0; i < returnGrid3.get_height(); i++){
-                for(int j = 0; j < returnGrid3.get_width(); j++){
-                    returnGrid3.gridCells[returnGrid3.get_index((returnGrid3.get_width() -1 -j),i)] = returnGrid2.gridCells[returnGrid2.get_index(i,j)];
-                }
+    //the quarter turns swap the width and height, and every cell is written once so no dead fill is needed
+    Grid rotatedGrid;
+    rotatedGrid.allocate((times % 2 == 1) ? height : width, (times % 2 == 1) ? width : height);
+    Cell* cells = rotatedGrid.gridCells.data();
+
+    //nested loops that read each row once and write it to where the turn takes it
+    for(int y = 0; y < height; y++){
+        const Cell* row = gridCells.data() + get_index(0, y);
+        for(int x = 0; x < width; x++){
+            if(times == 0){
+                cells[rotatedGrid.get_index(x, y)] = row[x];
+            }else if(times == 1){
+                cells[rotatedGrid.get_index(height - 1 - y, x)] = row[x];
+            }else if(times == 2){
+                cells[rotatedGrid.get_index(width - 1 - x, height - 1 - y)] = row[x];
+            }else{
+                cells[rotatedGrid.get_index(y, width - 1 - x)] = row[x];
             }
-            returnGridFinal = returnGrid3;
         }
     }
-    //conditional that checks if grid would be unaffected by rotation
-    if(times == 0){
-        returnGridFinal = Grid(width, height);
-        returnGridFinal.gridCells  = gridCells;
+    return rotatedGrid;
+}
+
+
+/**
+ * Grid::reflect()
+ *
+ * Create a copy of the grid that is mirrored left to right.
+ * Combined with Grid::rotate this reaches all eight orientations of a grid.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Make a glider
+ *      Grid glider = Zoo::glider();
+ *
+ *      // A glider flying towards the top left instead of the bottom right
+ *      Grid mirrored = glider.reflect().rotate(1);
+ *
+ * @return
+ *      Returns a copy of the grid that has been mirrored.
+ */
+Grid Grid::reflect() const{
+    Grid reflectedGrid = Grid(width, height);
+
+    //nested loops that copy each row into the new grid back to front
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            reflectedGrid.gridCells[get_index(width - 1 - x, y)] = gridCells[get_index(x, y)];
+        }
+    }
+    return reflectedGrid;
+}
+
+
+/**
+ * Grid::get_row_words()
+ *
+ * Gets the number of 64 bit words needed to hold one packed row of the grid.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of words written by Grid::pack_row(y, words).
+ */
+int Grid::get_row_words() const{
+    return (width + 63) / 64;
+}
+
+
+/**
+ * pack_word(cells, count)
+ *
+ * Helper to pack up to 64 cells into a word, the cell at i in bit i.
+ */
+static std::uint64_t pack_word(const Cell* cells, int count){
+    std::uint64_t word = 0;
+    int b = 0;
+
+    /*Cell::ALIVE ('#') has its lowest bit set and Cell::DEAD (' ') does not, so 8 cells are read at a time
+    and the multiply gathers the lowest bit of each byte into the top byte of the product*/
+    for(; b + 8 <= count; b += 8){
+        std::uint64_t eight;
+        std::memcpy(&eight, cells + b, 8);
+        eight &= 0x0101010101010101ULL;
+        word |= ((eight * 0x0102040810204080ULL) >> 56) << b;
+    }
+    for(; b < count; b++){
+        word |= std::uint64_t(cells[b] == Cell::ALIVE) << b;
+    }
+    return word;
+}
+
+/**
+ * Grid::pack_row(y, words)
+ *
+ * Packs a row of the grid into 64 bit words with one bit per cell.
+ * The cell at x is stored in bit (x % 64) of word (x / 64), a set bit is Cell::ALIVE.
+ * Bits past the right edge of the grid in the last word are left as 0.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Make a grid
+ *      Grid grid(100, 4);
+ *
+ *      // Pack the second row into two words
+ *      std::vector<std::uint64_t> words(grid.get_row_words());
+ *      grid.pack_row(1, words.data());
+ *
+ * @param y
+ *      The y coordinate of the row to pack.
+ *
+ * @param words
+ *      Pointer to at least Grid::get_row_words() words to write the packed row into.
+ *
+ * @throws
+ *      std::exception or sub-class if y is not a valid row within the grid.
+ */
+void Grid::pack_row(int y, std::uint64_t* words) const{
+    //exception
+    if(y >= get_height() || y < 0){
+        throw std::runtime_error("not within bounds");
     }
+    const Cell* row = gridCells.data() + get_index(0, y);
+
+    //loop that packs up to 64 cells into each word
+    for(int i = 0; i < get_row_words(); i++){
+        words[i] = pack_word(row + (i * 64), std::min(64, width - (i * 64)));
+    }
+}
 
-    return returnGridFinal;
+
+/**
+ * mix_hash(hash, word)
+ *
+ * Helper to fold one 64 bit word into a running hash.
+ */
+static std::uint64_t mix_hash(std::uint64_t hash, std::uint64_t word){
+    hash ^= word * 0x9e3779b97f4a7c15ULL;
+    hash = ((hash << 27) | (hash >> 37)) * 0xbf58476d1ce4e5b9ULL;
+    return hash;
+}
+
+
+/**
+ * Grid::hash(normalise = false)
+ *
+ * Hashes the size and cells of the grid into 64 bits.
+ * Equal grids always have equal hashes, and different grids almost never do.
+ * The function should be callable from a constant context.
+ *
+ * If normalise = true then only the bounding box of the alive cells is hashed, so the same pattern
+ * gives the same hash wherever it sits in the grid and whatever the size of the grid.
+ *
+ * @example
+ *
+ *      // Make two grids with a glider in different places
+ *      Grid x(16), y(32);
+ *      x.merge(Zoo::glider(), 1, 1);
+ *      y.merge(Zoo::glider(), 20, 5);
+ *
+ *      // The hashes differ, but the normalised hashes are the same
+ *      std::cout << (x.hash() == y.hash()) << (x.hash(true) == y.hash(true)) << std::endl;
+ *
+ * @param normalise
+ *      Optional parameter. If true then hash only the bounding box of the alive cells. Defaults to false.
+ *
+ * @return
+ *      Returns the hash of the grid.
+ */
+std::uint64_t Grid::hash(bool normalise) const{
+    if(normalise){
+        return hash(get_bounding_box());
+    }
+    return hash(Bounds{0, 0, width, height});
+}
+
+
+/**
+ * Grid::hash(window)
+ *
+ * Hashes a window of the grid into 64 bits, giving the same hash as the grid returned by
+ * Grid::crop(window.x0, window.y0, window.x1, window.y1) would have, without making the copy.
+ * The cells are hashed a packed word of 64 cells at a time.
+ * The function should be callable from a constant context.
+ *
+ * @param window
+ *      The window of cells to hash.
+ *
+ * @return
+ *      Returns the hash of the window.
+ *
+ * @throws
+ *      std::exception or sub-class if the window is not within the grid.
+ */
+std::uint64_t Grid::hash(Bounds window) const{
+    //exception
+    if(window.x0 < 0 || window.y0 < 0 || window.x1 > width || window.y1 > height){
+        throw std::runtime_error("not within bounds");
+    }
+    int windowWidth = std::max(window.x1 - window.x0, 0);
+    int windowHeight = std::max(window.y1 - window.y0, 0);
+    if(windowWidth == 0 || windowHeight == 0){
+        windowWidth = 0;
+        windowHeight = 0;
+    }
+
+    std::uint64_t hash = mix_hash(0, (std::uint64_t(windowWidth) << 32) | std::uint64_t(windowHeight));
+    int q = window.x0 / 64;
+    int s = window.x0 % 64;
+    int words = (windowWidth + 63) / 64;
+    std::uint64_t lastMask = (windowWidth % 64) ? ((std::uint64_t(1) << (windowWidth % 64)) - 1) : ~std::uint64_t(0);
+
+    //the packed words of a row the window covers, from word q on, with a spare word past the end for the shift
+    int covered = std::min(words + 1, get_row_words() - q);
+    std::vector<std::uint64_t> row(std::size_t(words) + 1, 0);
+
+    //loop that packs only the words of each row under the window and shifts them so it starts at bit 0
+    for(int y = window.y0; y < window.y0 + windowHeight; y++){
+        const Cell* cells = gridCells.data() + get_index(0, y);
+        for(int i = 0; i < covered; i++){
+            int x = (q + i) * 64;
+            row[i] = pack_word(cells + x, std::min(64, width - x));
+        }
+        for(int i = 0; i < words; i++){
+            std::uint64_t word = s ? ((row[i] >> s) | (row[i + 1] << (64 - s))) : row[i];
+            if(i == words - 1){
+                word &= lastMask;
+            }
+            hash = mix_hash(hash, word);
+        }
+    }
+
+    //final avalanche so every input bit affects every output bit
+    hash ^= hash >> 31;
+    hash *= 0x94d049bb133111ebULL;
+    hash ^= hash >> 29;
+    return hash;
+}
+
+
+/**
+ * Grid::operator==(other)
+ *
+ * Checks if two grids are the same size and every cell is equal.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Rotating a block does not change it
+ *      Grid block(2);
+ *      block(0, 0) = block(1, 0) = block(0, 1) = block(1, 1) = Cell::ALIVE;
+ *      std::cout << (block == block.rotate(1)) << std::endl;
+ *
+ * @param other
+ *      The grid to compare against.
+ *
+ * @return
+ *      Returns true if the grids are equal.
+ */
+bool Grid::operator==(const Grid& other) const{
+    return width == other.width && height == other.height && gridCells == other.gridCells;
+}
+
+
+/**
+ * Grid::operator!=(other)
+ *
+ * Checks if two grids differ in size or in any cell.
+ * The function should be callable from a constant context.
+ *
+ * @param other
+ *      The grid to compare against.
+ *
+ * @return
+ *      Returns true if the grids are not equal.
+ */
+bool Grid::operator!=(const Grid& other) const{
+    return !(*this == other);
 }
 
 
@@ -16,6 +16,13 @@
 #include <vector>
 #include <iostream>
 #include <stdexcept>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
 
 /**
  * A Cell is a char limited to two named values for Cell::DEAD and Cell::ALIVE.
@@ -25,6 +32,93 @@ enum Cell : char {
     ALIVE = '#'
 };
 
+/**
+ * A Bounds is a rectangle of cells spanning [x0, x1) by [y0, y1), matching the window used by Grid::crop.
+ * A Bounds with no area (x0 >= x1 or y0 >= y1) is considered empty.
+ */
+struct Bounds {
+    int x0;
+    int y0;
+    int x1;
+    int y1;
+};
+
+void* allocate_cells(std::size_t bytes);
+void free_cells(void* cells, std::size_t bytes);
+std::pmr::memory_resource* get_cell_resource();
+std::pmr::memory_resource* set_cell_resource(std::pmr::memory_resource* resource);
+
+/**
+ * A CellAllocator is the allocator behind a Grid's cells, see allocate_cells(bytes) in grid.cpp.
+ *      - It takes its cells from the memory resource set for the thread that made it, see set_cell_resource, such
+ *        as a GridArena that reuses the memory of short-lived grids. Without one it uses allocate_cells(bytes).
+ *      - Blocks of a huge page or more are mapped fresh and aligned to a huge page, so no page of them is touched
+ *        until a cell on it is first written.
+ *      - Cells added without a value are value-initialised like any allocator's, unless the allocator was made
+ *        with written = false. Grid::allocate(width, height) uses such an allocator to leave each page to be first
+ *        written by the thread that will use it.
+ *      - Assigning one grid to another copies or moves the cells into the target's memory, so a grid never ends up
+ *        holding memory from a resource it wasn't made with.
+ *      - Move constructing a grid takes over the cells when they come from the calling thread's resource, or both
+ *        use allocate_cells(bytes). Otherwise they are copied into memory from the calling thread's resource, so a
+ *        grid moved out of an ArenaScope does not hold on to the arena.
+ *      - std::swap of two grids goes through a move constructed temporary and two move assignments, so grids made
+ *        on the thread that swaps them just trade cells, while grids from other resources are copied across. The
+ *        vectors themselves are never swapped, which would be undefined for two different resources.
+ */
+template <typename T>
+struct CellAllocator {
+    typedef T value_type;
+    typedef std::false_type propagate_on_container_copy_assignment;
+    typedef std::false_type propagate_on_container_move_assignment;
+    typedef std::false_type propagate_on_container_swap;
+    typedef std::false_type is_always_equal;
+
+    std::pmr::memory_resource* resource;
+    bool written;
+
+    CellAllocator() : resource(get_cell_resource()), written(true) {}
+    template <typename U>
+    CellAllocator(const CellAllocator<U>& other, bool written = true) : resource(other.resource), written(written) {}
+
+    T* allocate(std::size_t count) {
+        if (resource != nullptr) {
+            return static_cast<T*>(resource->allocate(count * sizeof(T), alignof(T)));
+        }
+        return static_cast<T*>(allocate_cells(count * sizeof(T)));
+    }
+    void deallocate(T* cells, std::size_t count) {
+        if (resource != nullptr) {
+            resource->deallocate(cells, count * sizeof(T), alignof(T));
+            return;
+        }
+        free_cells(cells, count * sizeof(T));
+    }
+    CellAllocator select_on_container_copy_construction() const {
+        return CellAllocator();
+    }
+    template <typename U>
+    void construct(U* cell) {
+        if (written) {
+            ::new(static_cast<void*>(cell)) U();
+        } else {
+            ::new(static_cast<void*>(cell)) U;
+        }
+    }
+    template <typename U, typename... Args>
+    void construct(U* cell, Args&&... args) {
+        ::new(static_cast<void*>(cell)) U(std::forward<Args>(args)...);
+    }
+    template <typename U>
+    bool operator==(const CellAllocator<U>& other) const {
+        return resource == other.resource;
+    }
+    template <typename U>
+    bool operator!=(const CellAllocator<U>& other) const {
+        return resource != other.resource;
+    }
+};
+
 /**
  * Declare the structure of the Grid class for representing a 2d grid of cells.
  */
@@ -32,22 +126,28 @@ class Grid {
     private:
         int width;
         int height;
-        std::vector<Cell> gridCells;
+        std::vector<Cell, CellAllocator<Cell>> gridCells;
 
         int get_index(int x, int y) const;
     public:
         Grid();
         Grid(int height);
         Grid(int width, int height);
+        Grid(const Grid& other) = default;
+        Grid(Grid&& other);
+        Grid& operator=(const Grid& other) = default;
+        Grid& operator=(Grid&& other) = default;
 
         int get_width() const;
         int get_height() const;
         int get_total_cells() const;
         int get_alive_cells() const;
         int get_dead_cells() const;
+        Bounds get_bounding_box() const;
 
         void resize(int square_size);
         void resize(int width, int height);
+        void allocate(int width, int height);
 
 
         Cell get(int x, int y) const;
@@ -56,11 +156,20 @@ class Grid {
         Cell& operator()( int x, int y);
         const Cell& operator()( int x, int y)const;
 
-        Grid crop(int x0, int y0, int x1, int y1);
+        Grid crop(int x0, int y0, int x1, int y1) const;
 
         void merge( Grid other, int x0, int y0, bool alive_only = false);
 
-        Grid rotate(int rotation);
+        Grid rotate(int rotation) const;
+        Grid reflect() const;
+
+        int get_row_words() const;
+        void pack_row(int y, std::uint64_t* words) const;
+
+        std::uint64_t hash(bool normalise = false) const;
+        std::uint64_t hash(Bounds window) const;
+        bool operator==(const Grid& other) const;
+        bool operator!=(const Grid& other) const;
 
         friend std::ostream& operator<<(std::ostream& os, const Grid& grid);
         // How to draw an owl:
@@ -68,4 +177,16 @@ class Grid {
         //      Step 2. Draw the rest of the owl.
 };
 
+/**
+ * Let Grid be used as a key in std::unordered_map and std::unordered_set by hashing its cells.
+ */
+namespace std {
+    template <>
+    struct hash<Grid> {
+        std::size_t operator()(const Grid& grid) const {
+            return grid.hash();
+        }
+    };
+}
+
 #endif
@@ -0,0 +1,86 @@
+/**
+ * Declares the GridArena and ArenaScope classes for reusing the memory of short-lived grids.
+ * Rich documentation for the api and behaviour the classes can be found in grid_arena.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include <cstddef>
+#include <memory_resource>
+
+/**
+ * An ArenaCounts reports the memory a GridArena has handed out since it was made or its counts were reset.
+ *      - allocations and deallocations count the blocks grids asked for and gave back, and bytes their total size.
+ *      - peakBytes is the most bytes held by grids at once.
+ *      - upstreamAllocations and upstreamBytes count the memory the arena itself had to allocate, which stays flat
+ *        once the arena has warmed up and is reusing the memory of freed grids.
+ */
+struct ArenaCounts {
+    long long allocations;
+    long long deallocations;
+    long long bytes;
+    long long peakBytes;
+    long long upstreamAllocations;
+    long long upstreamBytes;
+};
+
+/**
+ * Declare the structure of the GridArena class, a memory resource that pools the cells of short-lived grids and
+ * counts its allocations. A GridArena must only be used by one thread at a time.
+ */
+class GridArena : public std::pmr::memory_resource {
+    private:
+        /**
+         * The Upstream forwards the arena's own allocations to the upstream resource and counts them.
+         */
+        class Upstream : public std::pmr::memory_resource {
+            public:
+                std::pmr::memory_resource* resource;
+                long long allocations;
+                long long bytes;
+
+                explicit Upstream(std::pmr::memory_resource* resource);
+
+            private:
+                void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+                void do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+                bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+        };
+
+        Upstream upstream;
+        std::pmr::unsynchronized_pool_resource pool;
+        ArenaCounts counts;
+        long long heldBytes;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void* block, std::size_t bytes, std::size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+    public:
+        explicit GridArena(std::pmr::memory_resource* upstream_resource = std::pmr::new_delete_resource());
+        GridArena(const GridArena&) = delete;
+        GridArena& operator=(const GridArena&) = delete;
+
+        ArenaCounts get_counts() const;
+        void reset_counts();
+        void release();
+};
+
+/**
+ * Declare the structure of the ArenaScope class, which makes the grids made on the calling thread take their cells
+ * from a memory resource until the scope ends.
+ */
+class ArenaScope {
+    private:
+        std::pmr::memory_resource* previous;
+
+    public:
+        explicit ArenaScope(std::pmr::memory_resource& resource);
+        ~ArenaScope();
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+};
@@ -0,0 +1,454 @@
+/**
+ * Implements classes representing Larger than Life rules and a 2d grid world for simulating them.
+ *      - Larger than Life generalises Life-like rules to count the alive cells in a (2R + 1) x (2R + 1) square
+ *        around each cell, e.g. Bosco's rule "R5,C0,M1,S34..58,B34..45,NM" counts a radius 5 square.
+ *          - R is the range, from 1 to 500.
+ *          - C is the number of states, only 0 or 2 are supported (both mean two states).
+ *          - M1 counts the middle cell as well as its neighbours, M0 does not.
+ *          - S and B are the inclusive ranges of counts that keep an alive cell alive or bring a dead cell to life.
+ *          - N is the neighbourhood, only the Moore square NM is supported.
+ *          - https://www.conwaylife.com/wiki/Larger_than_Life
+ *
+ *      - Counting each neighbourhood directly would cost O(R^2) per cell, so LargerThanLifeWorld instead builds a
+ *        summed-area table of the grid each step.
+ *          - Each entry holds the number of alive cells above and to the left of it.
+ *          - The count for any square is then four lookups, O(1) per cell whatever the range.
+ *          - The table covers the grid padded by R on every side, with dead cells outside a plane grid
+ *            or the wrapped cells of a toroidal grid, so both topologies use the same lookups.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "larger_than_life.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+
+/**
+ * parse_count(text)
+ *
+ * Private helper function to parse a non-negative number in a rule string.
+ *
+ * @param text
+ *      The digits to parse.
+ *
+ * @return
+ *      The parsed number.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the text is empty, too long, or not all digits.
+ */
+static int parse_count(const std::string& text){
+    //exception
+    if(text.empty() || text.size() > 6 || text.find_first_not_of("0123456789") != std::string::npos){
+        throw std::runtime_error("rule values must be numbers");
+    }
+    return std::stoi(text);
+}
+
+/**
+ * LargerThanLifeRule::LargerThanLifeRule()
+ *
+ * Construct Conway's Game of Life as a Larger than Life rule, R1,C0,M0,S2..3,B3..3,NM.
+ *
+ * @example
+ *
+ *      // Make the standard rule
+ *      LargerThanLifeRule rule;
+ *
+ */
+LargerThanLifeRule::LargerThanLifeRule(){
+    this->name = "R1,C0,M0,S2..3,B3..3,NM";
+    this->range = 1;
+    this->middle = false;
+    this->birthMin = 3;
+    this->birthMax = 3;
+    this->survivalMin = 2;
+    this->survivalMax = 3;
+}
+
+/**
+ * LargerThanLifeRule::LargerThanLifeRule(rule)
+ *
+ * Construct a rule by parsing a rule string in the comma separated notation used by Golly,
+ * e.g. "R5,C0,M1,S34..58,B34..45,NM". Letters may be upper or lower case and parts may be in any order.
+ * R, S, and B are required, C defaults to 0, M to 0, and N to M. A single count such as "B3" means "B3..3".
+ *
+ * @example
+ *
+ *      // Make Bosco's rule
+ *      LargerThanLifeRule bosco("R5,C0,M1,S34..58,B34..45,NM");
+ *
+ * @param rule
+ *      The rule string to parse.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - A part starts with a letter other than R, C, M, S, B, or N, or a letter is repeated.
+ *          - R, S, or B is missing.
+ *          - The range is not from 1 to 500.
+ *          - The number of states is not 0 or 2, or M is not 0 or 1, or the neighbourhood is not M.
+ *          - A count is not a number, or a range of counts is reversed or beyond the size of the neighbourhood.
+ */
+LargerThanLifeRule::LargerThanLifeRule(std::string rule) : LargerThanLifeRule(){
+    std::string seen;
+    int bounds[2][2] = {{0, 0}, {0, 0}};
+
+    //loop that reads each comma separated part
+    std::size_t start = 0;
+    while(start <= rule.size()){
+        std::size_t comma = rule.find(',', start);
+        if(comma == std::string::npos){
+            comma = rule.size();
+        }
+        std::string part = rule.substr(start, comma - start);
+        start = comma + 1;
+
+        //exception
+        if(part.empty() || std::string("rcmsbn").find(char(std::tolower(static_cast<unsigned char>(part[0])))) == std::string::npos){
+            throw std::runtime_error("rule part must start with R, C, M, S, B, or N");
+        }
+        char letter = char(std::tolower(static_cast<unsigned char>(part[0])));
+        std::string value = part.substr(1);
+        //exception
+        if(seen.find(letter) != std::string::npos){
+            throw std::runtime_error("rule part repeated");
+        }
+        seen += letter;
+
+        if(letter == 'r'){
+            this->range = parse_count(value);
+        }else if(letter == 'c'){
+            //exception
+            if(parse_count(value) != 0 && parse_count(value) != 2){
+                throw std::runtime_error("only two state rules are supported");
+            }
+        }else if(letter == 'm'){
+            //exception
+            if(value != "0" && value != "1"){
+                throw std::runtime_error("rule middle must be 0 or 1");
+            }
+            this->middle = (value == "1");
+        }else if(letter == 'n'){
+            //exception
+            if(value != "M" && value != "m"){
+                throw std::runtime_error("only the Moore neighbourhood is supported");
+            }
+        }else{
+            std::size_t dots = value.find("..");
+            int* counts = bounds[letter == 'b' ? 0 : 1];
+            counts[0] = parse_count(value.substr(0, dots));
+            counts[1] = (dots == std::string::npos) ? counts[0] : parse_count(value.substr(dots + 2));
+        }
+    }
+    //exception
+    if(seen.find('r') == std::string::npos || seen.find('s') == std::string::npos || seen.find('b') == std::string::npos){
+        throw std::runtime_error("rule must have R, S, and B parts");
+    }
+    //exception
+    if(range < 1 || range > 500){
+        throw std::runtime_error("rule range must be from 1 to 500");
+    }
+    int cells = ((2 * range) + 1) * ((2 * range) + 1);
+    for(int (&counts)[2] : bounds){
+        //exception
+        if(counts[0] > counts[1] || counts[1] > cells){
+            throw std::runtime_error("rule counts must be an increasing range within the neighbourhood");
+        }
+    }
+    this->birthMin = bounds[0][0];
+    this->birthMax = bounds[0][1];
+    this->survivalMin = bounds[1][0];
+    this->survivalMax = bounds[1][1];
+
+    //store the name in the usual order
+    this->name = "R" + std::to_string(range) + ",C0,M" + (middle ? "1" : "0") +
+                 ",S" + std::to_string(survivalMin) + ".." + std::to_string(survivalMax) +
+                 ",B" + std::to_string(birthMin) + ".." + std::to_string(birthMax) + ",NM";
+}
+
+/**
+ * LargerThanLifeRule::get_name()
+ *
+ * Gets the rule string with every part in the usual order, e.g. "R5,C0,M1,S34..58,B34..45,NM".
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The name of the rule.
+ */
+std::string LargerThanLifeRule::get_name() const{
+    return this->name;
+}
+
+/**
+ * LargerThanLifeRule::get_range()
+ *
+ * Gets the range R of the neighbourhood, which spans R cells in every direction.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The range of the rule.
+ */
+int LargerThanLifeRule::get_range() const{
+    return this->range;
+}
+
+/**
+ * LargerThanLifeRule::counts_middle()
+ *
+ * Checks if the cell itself is included in its neighbour count (M1).
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      Returns true if the middle cell is counted.
+ */
+bool LargerThanLifeRule::counts_middle() const{
+    return this->middle;
+}
+
+/**
+ * LargerThanLifeRule::get_transition(cell, neighbours)
+ *
+ * Gets the next state of a cell from its current state and count of alive cells in its neighbourhood.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // A dead cell with 40 alive cells around it is born in Bosco's rule
+ *      Cell cell = LargerThanLifeRule("R5,C0,M1,S34..58,B34..45,NM").get_transition(Cell::DEAD, 40);
+ *
+ * @param cell
+ *      The current state of the cell.
+ *
+ * @param neighbours
+ *      The number of alive cells in the neighbourhood, including the cell itself for M1 rules.
+ *
+ * @return
+ *      The state of the cell in the next generation.
+ */
+Cell LargerThanLifeRule::get_transition(Cell cell, int neighbours) const{
+    if(cell == Cell::ALIVE){
+        return (neighbours >= survivalMin && neighbours <= survivalMax) ? Cell::ALIVE : Cell::DEAD;
+    }
+    return (neighbours >= birthMin && neighbours <= birthMax) ? Cell::ALIVE : Cell::DEAD;
+}
+
+/**
+ * LargerThanLifeWorld::LargerThanLifeWorld(initial_state, rule)
+ *
+ * Construct a world using the size and cells of an existing grid, simulated with a Larger than Life rule.
+ *
+ * @example
+ *
+ *      // Run Bosco's rule on a soup
+ *      LargerThanLifeWorld world(Zoo::load_ascii("path/to/soup.gol"), LargerThanLifeRule("R5,C0,M1,S34..58,B34..45,NM"));
+ *
+ * @param initial_state
+ *      The state of the constructed world.
+ *
+ * @param rule
+ *      The rule to simulate with.
+ */
+LargerThanLifeWorld::LargerThanLifeWorld(Grid initial_state, LargerThanLifeRule rule){
+    this->width = initial_state.get_width();
+    this->height = initial_state.get_height();
+    this->rule = rule;
+    this->generation = 0;
+
+    currentGrid = initial_state;
+    nextGrid = Grid(width, height);
+}
+
+/**
+ * LargerThanLifeWorld::get_width()
+ *
+ * Gets the current width of the world.
+ *
+ * @return
+ *      The width of the world.
+ */
+int LargerThanLifeWorld::get_width(){
+    return this->width;
+}
+
+/**
+ * LargerThanLifeWorld::get_height()
+ *
+ * Gets the current height of the world.
+ *
+ * @return
+ *      The height of the world.
+ */
+int LargerThanLifeWorld::get_height(){
+    return this->height;
+}
+
+/**
+ * LargerThanLifeWorld::get_total_cells()
+ *
+ * Gets the total number of cells in the world.
+ *
+ * @return
+ *      The number of total cells.
+ */
+int LargerThanLifeWorld::get_total_cells(){
+    return (this->height * this->width);
+}
+
+/**
+ * LargerThanLifeWorld::get_alive_cells()
+ *
+ * Counts how many cells in the world are alive.
+ *
+ * @return
+ *      The number of alive cells.
+ */
+int LargerThanLifeWorld::get_alive_cells(){
+    return currentGrid.get_alive_cells();
+}
+
+/**
+ * LargerThanLifeWorld::get_dead_cells()
+ *
+ * Counts how many cells in the world are dead.
+ *
+ * @return
+ *      The number of dead cells.
+ */
+int LargerThanLifeWorld::get_dead_cells(){
+    return currentGrid.get_dead_cells();
+}
+
+/**
+ * LargerThanLifeWorld::get_generation()
+ *
+ * Gets the number of steps the world has taken since it was constructed.
+ *
+ * @return
+ *      The current generation number.
+ */
+int LargerThanLifeWorld::get_generation(){
+    return generation;
+}
+
+/**
+ * LargerThanLifeWorld::get_state()
+ *
+ * Return a read-only reference to the current state, without copying it.
+ *
+ * @return
+ *      A reference to the current state.
+ */
+const Grid& LargerThanLifeWorld::get_state(){
+    return currentGrid;
+}
+
+/**
+ * LargerThanLifeWorld::get_rule()
+ *
+ * Gets the rule the world is simulated with.
+ *
+ * @return
+ *      A read-only reference to the rule.
+ */
+const LargerThanLifeRule& LargerThanLifeWorld::get_rule(){
+    return rule;
+}
+
+/**
+ * LargerThanLifeWorld::step(toroidal)
+ *
+ * Take one step in the world's Larger than Life rule.
+ *
+ * Builds a summed-area table of the current grid padded by the range on every side, then reads each cell's
+ * neighbourhood count from the four corners of its square and writes the next state to the next grid.
+ * Then swaps the grids. The cost per cell does not depend on the range.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then the step will consider the grid as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom. Defaults to false.
+ */
+void LargerThanLifeWorld::step(bool toroidal){
+    if(width == 0 || height == 0){
+        generation++;
+        return;
+    }
+    int range = rule.get_range();
+    int span = (2 * range) + 1;
+    int paddedWidth = width + (2 * range);
+    int paddedHeight = height + (2 * range);
+    int stride = paddedWidth + 1;
+
+    //the grid column under each padded column, or -1 for dead padding
+    std::vector<int> columns(paddedWidth);
+    for(int px = 0; px < paddedWidth; px++){
+        int x = px - range;
+        if(toroidal){
+            x = ((x % width) + width) % width;
+        }
+        columns[px] = (x >= 0 && x < width) ? x : -1;
+    }
+
+    //summed-area table with a leading row and column of zeros
+    sums.assign(std::size_t(stride) * (paddedHeight + 1), 0);
+    for(int py = 0; py < paddedHeight; py++){
+        int y = py - range;
+        if(toroidal){
+            y = ((y % height) + height) % height;
+        }
+        const int* above = &sums[std::size_t(py) * stride];
+        int* sum = &sums[std::size_t(py + 1) * stride];
+        if(y < 0 || y >= height){
+            std::copy(above, above + stride, sum);
+            continue;
+        }
+        const Cell* row = &currentGrid(0, y);
+        int rowSum = 0;
+        for(int px = 0; px < paddedWidth; px++){
+            rowSum += (columns[px] >= 0 && row[columns[px]] == Cell::ALIVE);
+            sum[px + 1] = above[px + 1] + rowSum;
+        }
+    }
+
+    //nested loops that read each square's count from the corners of the table
+    for(int y = 0; y < height; y++){
+        const int* top = &sums[std::size_t(y) * stride];
+        const int* bottom = &sums[std::size_t(y + span) * stride];
+        const Cell* row = &currentGrid(0, y);
+        Cell* next = &nextGrid(0, y);
+        for(int x = 0; x < width; x++){
+            int count = bottom[x + span] - bottom[x] - top[x + span] + top[x];
+            if(!rule.counts_middle()){
+                count -= (row[x] == Cell::ALIVE);
+            }
+            next[x] = rule.get_transition(row[x], count);
+        }
+    }
+
+    //take the next step
+    std::swap(currentGrid, nextGrid);
+    generation++;
+}
+
+/**
+ * LargerThanLifeWorld::advance(steps, toroidal)
+ *
+ * Advance multiple steps in the world's Larger than Life rule.
+ * Should be implemented by invoking LargerThanLifeWorld::step(toroidal).
+ *
+ * @param steps
+ *      The number of steps to advance the world forward.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then the step will consider the grid as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom. Defaults to false.
+ */
+void LargerThanLifeWorld::advance(int steps, bool toroidal){
+    //change world the number of steps
+    for(int i = 0; i < steps; i++){
+        step(toroidal);
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * Declares classes representing Larger than Life rules and a 2d grid world for simulating them.
+ * Rich documentation for the api and behaviour of the classes can be found in larger_than_life.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the classes.
+// #include ...
+#include "grid.h"
+#include <string>
+#include <vector>
+
+/**
+ * Declare the structure of the LargerThanLifeRule class for representing which cells are born and which survive
+ * when counting the alive cells within a range R square around each cell.
+ */
+class LargerThanLifeRule {
+    private:
+        std::string name;
+        int range;
+        bool middle;
+        int birthMin;
+        int birthMax;
+        int survivalMin;
+        int survivalMax;
+
+    public:
+        LargerThanLifeRule();
+        explicit LargerThanLifeRule(std::string rule);
+
+        std::string get_name() const;
+        int get_range() const;
+        bool counts_middle() const;
+        Cell get_transition(Cell cell, int neighbours) const;
+};
+
+/**
+ * Declare the structure of the LargerThanLifeWorld class for representing a 2d grid world.
+ *
+ * Like World, a LargerThanLifeWorld holds two equally sized Grid objects for the current state and next state,
+ * swapped using std::swap after each update step. It also keeps the summed-area table used to count neighbours
+ * so it does not need to be reallocated every step.
+ */
+class LargerThanLifeWorld {
+    private:
+        int width;
+        int height;
+        Grid currentGrid;
+        Grid nextGrid;
+        LargerThanLifeRule rule;
+        std::vector<int> sums;
+        int generation;
+
+    public:
+        LargerThanLifeWorld(Grid initial_state, LargerThanLifeRule rule);
+
+        int get_width();
+        int get_height();
+        int get_total_cells();
+        int get_alive_cells();
+        int get_dead_cells();
+        int get_generation();
+
+        const Grid& get_state();
+        const LargerThanLifeRule& get_rule();
+
+        void step(bool toroidal = false);
+        void advance(int steps, bool toroidal = false);
+};
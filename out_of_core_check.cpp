@@ -0,0 +1,136 @@
+/**
+ * A differential check of OutOfCoreWorld against World, run as its own program.
+ *      - Each case fills a world with random cells, advances it a few generations at a time with OutOfCoreWorld and
+ *        with World, and compares the whole world and its alive cells after each stretch.
+ *          - Every case is run on the plane and the torus, for a rule with and without B6 and for a B2 rule
+ *            whose debris grows at the speed of light across tile edges.
+ *
+ *      - The cases are chosen to cover what is easy to get wrong.
+ *          - Caches of 1, 2 and 3 tiles, far too small to hold a strip, so tiles are thrown out and read back
+ *            while they are still needed, up to a cache that holds both generations and runs from memory.
+ *          - Worlds that are not a whole number of tiles across or down, and one smaller than a single tile, so
+ *            the torus wraps within the last tile.
+ *
+ *      - Prints each case that fails, and exits with 0 if every case matched or 1 if any did not.
+ *
+ * @example
+ *
+ *      // Build and run the check, keeping the scratch files in /tmp
+ *      g++ -std=c++20 -pthread -o out_of_core_check out_of_core_check.cpp out_of_core_world.cpp world.cpp ...
+ *      ./out_of_core_check /tmp
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "out_of_core_world.h"
+#include "world.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+namespace {
+
+/**
+ * A Shape is a size of world and the tiles and cache to keep it in.
+ */
+struct Shape {
+    int width;
+    int height;
+    int tile_size;
+    std::size_t cache_tiles;
+};
+
+}
+
+/**
+ * random_grid(width, height, seed)
+ *
+ * Gets a grid with about a quarter of its cells alive, the same for the same seed.
+ */
+static Grid random_grid(int width, int height, unsigned int seed){
+    Grid grid(width, height);
+    std::mt19937 generator(seed);
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            if(generator() % 4 == 0){
+                grid(x, y) = Cell::ALIVE;
+            }
+        }
+    }
+    return grid;
+}
+
+/**
+ * check(shape, rule, topology, path)
+ *
+ * Run one case, advancing 4 stretches of 5 generations.
+ *
+ * @return
+ *      true if the worlds matched after every stretch, false otherwise.
+ */
+static bool check(const Shape& shape, const Rule& rule, Topology topology, const std::string& path){
+    Grid start = random_grid(shape.width, shape.height, unsigned(shape.width * 31 + shape.height));
+    try{
+        OutOfCoreWorld tiled(shape.width, shape.height, path, shape.cache_tiles, shape.tile_size);
+        tiled.set_rule(rule);
+        tiled.set_cells(start, 0, 0);
+        World world(start);
+        world.set_rule(rule);
+
+        for(int stretch = 0; stretch < 4; stretch++){
+            tiled.advance(5, topology);
+            world.advance(5, topology);
+            if(tiled.get_cells(0, 0, shape.width, shape.height) != world.get_state() ||
+               tiled.get_alive_cells() != world.get_state().get_alive_cells()){
+                return false;
+            }
+        }
+    }catch(const std::exception& error){
+        std::cerr << error.what() << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]){
+    std::string directory = argc > 1 ? argv[1] : "/tmp";
+    std::string path = directory + "/out_of_core_check_" + std::to_string(getpid()) + ".tiles";
+
+    std::vector<Shape> shapes = {
+        {300, 200, 64, 1},
+        {300, 200, 64, 2},
+        {300, 200, 64, 3},
+        {300, 200, 64, 1024},
+        {200, 130, 128, 1},
+        {5, 3, 64, 1},
+        {64, 64, 64, 1},
+    };
+    std::vector<Topology> topologies = {Topology::PLANE, Topology::TORUS};
+    std::vector<std::string> rules = {"B3/S23", "B36/S23", "B2-a/S12"};
+
+    int cases = 0;
+    int failures = 0;
+    for(const Shape& shape : shapes){
+        for(Topology topology : topologies){
+            for(const std::string& rule : rules){
+                if(!check(shape, Rule(rule), topology, path)){
+                    std::cout << "MISMATCH " << shape.width << "x" << shape.height << " tiles " << shape.tile_size
+                              << " cache " << shape.cache_tiles << " topology " << int(topology) << " rule " << rule
+                              << std::endl;
+                    failures++;
+                }
+                cases++;
+            }
+        }
+    }
+
+    std::cout << (cases - failures) << " of " << cases << " cases matched" << std::endl;
+    return failures == 0 ? 0 : 1;
+}
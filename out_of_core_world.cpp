@@ -0,0 +1,734 @@
+/**
+ * Implements a class representing a world too large to hold in memory, kept in tiles on disk.
+ *      - The world is cut into square tiles whose rows of cells are packed 64 to a word. A scratch file holds two
+ *        copies of every tile, the current generation's and the next's, and the copies swap roles each step.
+ *          - Only an LRU cache of tiles is held in memory, so the memory used is set by the cache size and not the
+ *            size of the world. A smaller cache means more reads, but never a failure.
+ *          - Tiles that have no alive cells are never written or read. A flag per tile says which tiles are
+ *            occupied, and tiles with no occupied neighbours are skipped by a step.
+ *
+ *      - A step works through the tiles in vertical strips, row by row within a strip, with the strip as wide as
+ *        lets four rows of its tiles and their neighbours stay in the cache, three around the row being stepped and
+ *        one being prefetched. Each tile is then read from disk about (strip + 2) / strip times a generation,
+ *        rather than three times as a plain row by row order would.
+ *          - A prefetch thread reads the row of tiles after next while a row is being stepped, so the reads
+ *            overlap the work.
+ *          - If the cache can hold two whole generations the tiles written are kept in it too, and the world runs
+ *            from memory.
+ *
+ *      - Each tile is stepped by unpacking it and the ring of cells around it from its neighbours into bytes, then
+ *        sliding a 3x3 neighbourhood index along each row into the rule's 512 entry table, as in
+ *        World::step_region_isotropic(region, buffers).
+ *          - Any two state rule can be used, and the world can be a plane or a torus.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "out_of_core_world.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+
+/**
+ * OutOfCoreWorld::OutOfCoreWorld(width, height, path, cache_tiles, tile_size)
+ *
+ * Construct a world of dead cells kept in tiles in a new scratch file, which is removed when the world is.
+ *
+ * @example
+ *
+ *      // Make a 1 million x 1 million world, keeping up to 4096 tiles of 256 x 256 cells (32 MiB) in memory
+ *      OutOfCoreWorld world(1000000, 1000000, "/scratch/life.tiles", 4096);
+ *      world.set_cells(Zoo::r_pentomino(), 500000, 500000);
+ *      world.advance(1000);
+ *
+ * @param width
+ *      The width of the world.
+ *
+ * @param height
+ *      The height of the world.
+ *
+ * @param path
+ *      The path of the scratch file to keep the tiles in, which is created or emptied.
+ *
+ * @param cache_tiles
+ *      Optional parameter. The number of tiles to keep in memory. Defaults to 1024.
+ *
+ * @param tile_size
+ *      Optional parameter. The width and height of each tile, a multiple of 64. Defaults to 256.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The width or height is not positive, the cache has no room, or the tile size is not a positive
+ *            multiple of 64.
+ *          - The scratch file cannot be made.
+ */
+OutOfCoreWorld::OutOfCoreWorld(int width, int height, std::string path, std::size_t cache_tiles, int tile_size){
+    //exception
+    if(width <= 0 || height <= 0 || cache_tiles < 1 || tile_size <= 0 || tile_size % 64 != 0){
+        throw std::runtime_error("world must have an area, cache at least 1 tile and tiles a multiple of 64");
+    }
+    this->width = width;
+    this->height = height;
+    this->tileSize = tile_size;
+    this->rowWords = tile_size / 64;
+    this->tilesX = (width + tile_size - 1) / tile_size;
+    this->tilesY = (height + tile_size - 1) / tile_size;
+    this->generation = 0;
+    this->path = path;
+    this->tileBytes = std::size_t(tile_size) * rowWords * sizeof(std::uint64_t);
+    this->capacity = cache_tiles;
+    this->cacheWrites = cache_tiles >= std::size_t(2) * tilesX * tilesY;
+    this->counts = {0, 0, 0, 0, 0};
+    this->stopping = false;
+    set_rule(Rule());
+
+    long long tiles = static_cast<long long>(tilesX) * tilesY;
+    occupied.assign(std::size_t(tiles), 0);
+    emptyTile = std::make_shared<const Tile>(std::size_t(tile_size) * rowWords, 0);
+    cells.resize(std::size_t(tile_size + 2) * (tile_size + 2));
+
+    //the file is sparse, only the tiles that are written take up space
+    descriptor = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600);
+    //exception
+    if(descriptor < 0 || ftruncate(descriptor, off_t(2 * tiles) * off_t(tileBytes)) != 0){
+        if(descriptor >= 0){
+            close(descriptor);
+            unlink(path.c_str());
+        }
+        throw std::runtime_error("can't make scratch file " + path);
+    }
+    prefetcher = std::thread(&OutOfCoreWorld::run_prefetcher, this);
+}
+
+/**
+ * OutOfCoreWorld::~OutOfCoreWorld()
+ *
+ * Stop the prefetch thread, then close and remove the scratch file.
+ */
+OutOfCoreWorld::~OutOfCoreWorld(){
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+        queue.clear();
+    }
+    queueReady.notify_all();
+    prefetcher.join();
+    close(descriptor);
+    unlink(path.c_str());
+}
+
+/**
+ * OutOfCoreWorld::get_width()
+ *
+ * Gets the width of the world.
+ * The function should be callable from a constant context.
+ */
+int OutOfCoreWorld::get_width() const{
+    return width;
+}
+
+/**
+ * OutOfCoreWorld::get_height()
+ *
+ * Gets the height of the world.
+ * The function should be callable from a constant context.
+ */
+int OutOfCoreWorld::get_height() const{
+    return height;
+}
+
+/**
+ * OutOfCoreWorld::get_tile_size()
+ *
+ * Gets the width and height of each tile.
+ * The function should be callable from a constant context.
+ */
+int OutOfCoreWorld::get_tile_size() const{
+    return tileSize;
+}
+
+/**
+ * OutOfCoreWorld::get_generation()
+ *
+ * Gets the number of steps taken so far.
+ * The function should be callable from a constant context.
+ */
+long long OutOfCoreWorld::get_generation() const{
+    return generation;
+}
+
+/**
+ * OutOfCoreWorld::get_alive_cells()
+ *
+ * Counts the alive cells in the world, reading every occupied tile.
+ *
+ * @return
+ *      The number of alive cells.
+ */
+long long OutOfCoreWorld::get_alive_cells(){
+    long long alive = 0;
+    for(long long index = 0; index < static_cast<long long>(occupied.size()); index++){
+        if(occupied[std::size_t(index)]){
+            for(std::uint64_t word : *get_tile(index)){
+                alive += __builtin_popcountll(word);
+            }
+        }
+    }
+    return alive;
+}
+
+/**
+ * OutOfCoreWorld::get_counts()
+ *
+ * Gets how the tile cache has done since the world was made.
+ *
+ * @return
+ *      The counts of cache hits and misses, and of tiles read, written and prefetched.
+ */
+TileCounts OutOfCoreWorld::get_counts(){
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    return counts;
+}
+
+/**
+ * OutOfCoreWorld::get_rule()
+ *
+ * Gets the rule the world is simulated with.
+ * The function should be callable from a constant context.
+ */
+const Rule& OutOfCoreWorld::get_rule() const{
+    return rule;
+}
+
+/**
+ * OutOfCoreWorld::set_rule(new_rule)
+ *
+ * Changes the rule used by every following step. Worlds start with Conway's B3/S23 rule.
+ *
+ * @param new_rule
+ *      The rule to simulate with.
+ *
+ * @throws
+ *      std::exception or sub-class if the rule is a Generations rule with more than two states.
+ */
+void OutOfCoreWorld::set_rule(Rule new_rule){
+    //exception
+    if(new_rule.get_states() != 2){
+        throw std::runtime_error("rule has more than two states");
+    }
+    rule = new_rule;
+}
+
+/**
+ * OutOfCoreWorld::get_tile_index(tx, ty)
+ *
+ * Private helper function to get the index of the tile in column tx and row ty.
+ * The function should be callable from a constant context.
+ */
+long long OutOfCoreWorld::get_tile_index(int tx, int ty) const{
+    return (static_cast<long long>(ty) * tilesX) + tx;
+}
+
+/**
+ * OutOfCoreWorld::read_tile(key)
+ *
+ * Private helper function to read a generation's copy of a tile from the scratch file.
+ *
+ * @throws
+ *      std::exception or sub-class if the tile cannot be read.
+ */
+std::shared_ptr<const OutOfCoreWorld::Tile> OutOfCoreWorld::read_tile(const TileKey& key){
+    std::shared_ptr<Tile> tile = std::make_shared<Tile>(emptyTile->size());
+    off_t offset = off_t(((key.generation & 1) * static_cast<long long>(occupied.size())) + key.index) *
+                   off_t(tileBytes);
+    //exception
+    if(pread(descriptor, tile->data(), tileBytes, offset) != ssize_t(tileBytes)){
+        throw std::runtime_error("can't read tile from " + path);
+    }
+    return tile;
+}
+
+/**
+ * OutOfCoreWorld::insert_tile(key, tile, replace)
+ *
+ * Private helper function to put a tile into the cache as the most recently used, evicting the least recently used
+ * tiles beyond the cache's capacity. A prefetched tile never replaces one already cached, which may be newer.
+ */
+void OutOfCoreWorld::insert_tile(const TileKey& key, std::shared_ptr<const Tile> tile, bool replace){
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto found = cache.find(key);
+    if(found != cache.end()){
+        if(replace){
+            found->second.tile = tile;
+            recent.splice(recent.begin(), recent, found->second.place);
+        }
+        return;
+    }
+    recent.push_front(key);
+    cache[key] = {tile, recent.begin()};
+    while(cache.size() > capacity){
+        cache.erase(recent.back());
+        recent.pop_back();
+    }
+}
+
+/**
+ * OutOfCoreWorld::get_tile(index)
+ *
+ * Private helper function to get the current generation's copy of a tile, from the cache if it is there and
+ * otherwise from the scratch file. Unoccupied tiles are all dead and never read.
+ */
+std::shared_ptr<const OutOfCoreWorld::Tile> OutOfCoreWorld::get_tile(long long index){
+    if(!occupied[std::size_t(index)]){
+        return emptyTile;
+    }
+    TileKey key = {generation, index};
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        auto found = cache.find(key);
+        if(found != cache.end()){
+            counts.hits++;
+            recent.splice(recent.begin(), recent, found->second.place);
+            return found->second.tile;
+        }
+        counts.misses++;
+        counts.reads++;
+    }
+    std::shared_ptr<const Tile> tile = read_tile(key);
+    insert_tile(key, tile, false);
+    return tile;
+}
+
+/**
+ * OutOfCoreWorld::put_tile(tile_generation, index, tile, flags)
+ *
+ * Private helper function to write a generation's copy of a tile to the scratch file and mark whether it is
+ * occupied in flags. Unoccupied tiles are only marked. Written tiles are cached as well if the cache can hold two
+ * whole generations.
+ *
+ * @throws
+ *      std::exception or sub-class if the tile cannot be written.
+ */
+void OutOfCoreWorld::put_tile(long long tile_generation, long long index, std::shared_ptr<const Tile> tile,
+                              std::vector<std::uint8_t>& flags){
+    bool alive = std::any_of(tile->begin(), tile->end(), [](std::uint64_t word){ return word != 0; });
+    flags[std::size_t(index)] = alive;
+    if(!alive){
+        return;
+    }
+    off_t offset = off_t(((tile_generation & 1) * static_cast<long long>(occupied.size())) + index) *
+                   off_t(tileBytes);
+    //exception
+    if(pwrite(descriptor, tile->data(), tileBytes, offset) != ssize_t(tileBytes)){
+        throw std::runtime_error("can't write tile to " + path);
+    }
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        counts.writes++;
+    }
+    if(cacheWrites || tile_generation == generation){
+        insert_tile({tile_generation, index}, tile, true);
+    }
+}
+
+/**
+ * OutOfCoreWorld::prefetch(indices)
+ *
+ * Private helper function to ask the prefetch thread to read the current generation's copy of some tiles.
+ * Tiles that are unoccupied or already cached are left out.
+ */
+void OutOfCoreWorld::prefetch(const std::vector<long long>& indices){
+    std::vector<TileKey> wanted;
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex);
+        for(long long index : indices){
+            if(occupied[std::size_t(index)] && cache.find({generation, index}) == cache.end()){
+                wanted.push_back({generation, index});
+            }
+        }
+    }
+    if(wanted.empty()){
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.insert(queue.end(), wanted.begin(), wanted.end());
+    }
+    queueReady.notify_one();
+}
+
+/**
+ * OutOfCoreWorld::run_prefetcher()
+ *
+ * Private helper function run by the prefetch thread, which reads the tiles asked for into the cache until the
+ * world is destroyed. A tile that can't be read is left for the step to read and report.
+ */
+void OutOfCoreWorld::run_prefetcher(){
+    std::unique_lock<std::mutex> lock(queueMutex);
+    while(true){
+        queueReady.wait(lock, [this](){ return stopping || !queue.empty(); });
+        if(stopping){
+            return;
+        }
+        TileKey key = queue.front();
+        queue.pop_front();
+        lock.unlock();
+
+        bool cached;
+        {
+            std::lock_guard<std::mutex> guard(cacheMutex);
+            cached = cache.find(key) != cache.end();
+        }
+        if(!cached){
+            try{
+                std::shared_ptr<const Tile> tile = read_tile(key);
+                {
+                    std::lock_guard<std::mutex> guard(cacheMutex);
+                    counts.reads++;
+                    counts.prefetches++;
+                }
+                insert_tile(key, tile, false);
+            }
+            catch(const std::exception&){
+            }
+        }
+        lock.lock();
+    }
+}
+
+/**
+ * OutOfCoreWorld::set_cells(cells, x0, y0)
+ *
+ * Copies a grid of cells into the current generation with its top left corner at x0, y0. Cells of the grid that
+ * fall outside the world are left out, so a large pattern can be loaded a piece at a time.
+ *
+ * @example
+ *
+ *      // Put a glider near the top left
+ *      world.set_cells(Zoo::glider(), 10, 10);
+ *
+ * @param cells
+ *      The cells to copy in, dead cells included.
+ *
+ * @param x0
+ *      The x coordinate to put the grid's left edge at.
+ *
+ * @param y0
+ *      The y coordinate to put the grid's top edge at.
+ */
+void OutOfCoreWorld::set_cells(const Grid& cells, int x0, int y0){
+    int left = std::max(0, x0);
+    int top = std::max(0, y0);
+    int right = std::min(width, x0 + cells.get_width());
+    int bottom = std::min(height, y0 + cells.get_height());
+    if(left >= right || top >= bottom){
+        return;
+    }
+
+    //nested loops that rewrite every tile the grid overlaps
+    for(int ty = top / tileSize; ty <= (bottom - 1) / tileSize; ty++){
+        for(int tx = left / tileSize; tx <= (right - 1) / tileSize; tx++){
+            long long index = get_tile_index(tx, ty);
+            std::shared_ptr<Tile> tile = std::make_shared<Tile>(*get_tile(index));
+            for(int y = std::max(top, ty * tileSize); y < std::min(bottom, (ty + 1) * tileSize); y++){
+                std::uint64_t* row = tile->data() + (std::size_t(y - (ty * tileSize)) * rowWords);
+                for(int x = std::max(left, tx * tileSize); x < std::min(right, (tx + 1) * tileSize); x++){
+                    int bit = x - (tx * tileSize);
+                    std::uint64_t mask = std::uint64_t(1) << (bit % 64);
+                    if(cells.get(x - x0, y - y0) == Cell::ALIVE){
+                        row[bit / 64] |= mask;
+                    }else{
+                        row[bit / 64] &= ~mask;
+                    }
+                }
+            }
+            put_tile(generation, index, tile, occupied);
+        }
+    }
+}
+
+/**
+ * OutOfCoreWorld::get_cells(x0, y0, x1, y1)
+ *
+ * Copies a window of the current generation out into a grid. The window spans [x0, x1) by [y0, y1), as in
+ * Grid::crop, and must lie within the world.
+ *
+ * @example
+ *
+ *      // Look at the 100 x 100 cells around the centre
+ *      Grid centre = world.get_cells(499950, 499950, 500050, 500050);
+ *
+ * @param x0
+ *      Left coordinate of the window.
+ *
+ * @param y0
+ *      Top coordinate of the window.
+ *
+ * @param x1
+ *      Right coordinate of the window (1 greater than the largest index).
+ *
+ * @param y1
+ *      Bottom coordinate of the window (1 greater than the largest index).
+ *
+ * @return
+ *      A grid of the window's cells.
+ *
+ * @throws
+ *      std::exception or sub-class if the window is not within the world or has no area.
+ */
+Grid OutOfCoreWorld::get_cells(int x0, int y0, int x1, int y1){
+    //exception
+    if(x0 < 0 || y0 < 0 || x1 > width || y1 > height || x0 >= x1 || y0 >= y1){
+        throw std::runtime_error("not within bounds");
+    }
+    Grid window(x1 - x0, y1 - y0);
+
+    //nested loops that copy the alive cells out of every occupied tile the window overlaps
+    for(int ty = y0 / tileSize; ty <= (y1 - 1) / tileSize; ty++){
+        for(int tx = x0 / tileSize; tx <= (x1 - 1) / tileSize; tx++){
+            long long index = get_tile_index(tx, ty);
+            if(!occupied[std::size_t(index)]){
+                continue;
+            }
+            std::shared_ptr<const Tile> tile = get_tile(index);
+            for(int y = std::max(y0, ty * tileSize); y < std::min(y1, (ty + 1) * tileSize); y++){
+                const std::uint64_t* row = tile->data() + (std::size_t(y - (ty * tileSize)) * rowWords);
+                Cell* out = &window(0, y - y0);
+                for(int x = std::max(x0, tx * tileSize); x < std::min(x1, (tx + 1) * tileSize); x++){
+                    int bit = x - (tx * tileSize);
+                    if((row[bit / 64] >> (bit % 64)) & 1){
+                        out[x - x0] = Cell::ALIVE;
+                    }
+                }
+            }
+        }
+    }
+    return window;
+}
+
+/**
+ * OutOfCoreWorld::step_tile(tx, ty, torus, result)
+ *
+ * Private helper function to work out the next generation of one tile.
+ *
+ * The tile is unpacked into the middle of a (tile size + 2) square of bytes, 1 for alive and 0 for dead. The ring
+ * of cells around it, and on a torus the row and column just past a partial tile's edge of the world, are then
+ * filled in a cell at a time from the neighbouring tiles, wrapping across the edges of a torus. A 3x3 neighbourhood
+ * index is slid along each row of the bytes into the rule's table, and the new cells packed into the result. Cells
+ * of a partial tile beyond the edge of the world are left dead.
+ *
+ * @param tx
+ *      The column of the tile.
+ *
+ * @param ty
+ *      The row of the tile.
+ *
+ * @param torus
+ *      True to join the opposite edges of the world, false for dead cells beyond them.
+ *
+ * @param result
+ *      The tile of words to write the next generation into.
+ */
+void OutOfCoreWorld::step_tile(int tx, int ty, bool torus, Tile& result){
+    int span = tileSize + 2;
+    int x0 = tx * tileSize;
+    int y0 = ty * tileSize;
+
+    //the tile and its eight neighbours, wrapped on a torus or left unoccupied beyond the edges of a plane
+    long long around[3][3];
+    std::shared_ptr<const Tile> tiles[3][3];
+    for(int dy = -1; dy <= 1; dy++){
+        for(int dx = -1; dx <= 1; dx++){
+            int nx = tx + dx;
+            int ny = ty + dy;
+            if(torus){
+                nx = (nx + tilesX) % tilesX;
+                ny = (ny + tilesY) % tilesY;
+            }
+            bool inside = nx >= 0 && ny >= 0 && nx < tilesX && ny < tilesY;
+            around[dy + 1][dx + 1] = inside ? get_tile_index(nx, ny) : -1;
+            tiles[dy + 1][dx + 1] = inside ? get_tile(around[dy + 1][dx + 1]) : emptyTile;
+        }
+    }
+
+    //gets the state of any cell of the world next to the tile, or 0 beyond the edges of a plane
+    auto cell = [&](int x, int y) -> std::uint8_t {
+        if(torus){
+            x = (x % width + width) % width;
+            y = (y % height + height) % height;
+        }else if(x < 0 || y < 0 || x >= width || y >= height){
+            return 0;
+        }
+        long long index = get_tile_index(x / tileSize, y / tileSize);
+        for(int i = 0; i < 9; i++){
+            if(around[i / 3][i % 3] == index){
+                const Tile& tile = *tiles[i / 3][i % 3];
+                int bit = x % tileSize;
+                return (tile[(std::size_t(y % tileSize) * rowWords) + (bit / 64)] >> (bit % 64)) & 1;
+            }
+        }
+        return 0;
+    };
+
+    //nested loops that unpack the tile into the middle of the bytes
+    const Tile& centre = *tiles[1][1];
+    for(int y = 0; y < tileSize; y++){
+        std::uint8_t* row = cells.data() + (std::size_t(y + 1) * span) + 1;
+        for(int w = 0; w < rowWords; w++){
+            std::uint64_t word = centre[(std::size_t(y) * rowWords) + w];
+            for(int b = 0; b < 64; b++){
+                row[(w * 64) + b] = (word >> b) & 1;
+            }
+        }
+    }
+
+    //fill the rows and columns of bytes that come from beyond the tile, or beyond the world's edge
+    std::vector<int> edgeRows = {0, span - 1};
+    std::vector<int> edgeColumns = {0, span - 1};
+    if(torus && height > y0 && height < y0 + tileSize){
+        edgeRows.push_back(height - y0 + 1);
+    }
+    if(torus && width > x0 && width < x0 + tileSize){
+        edgeColumns.push_back(width - x0 + 1);
+    }
+    for(int row : edgeRows){
+        for(int column = 0; column < span; column++){
+            cells[(std::size_t(row) * span) + column] = cell(x0 + column - 1, y0 + row - 1);
+        }
+    }
+    for(int column : edgeColumns){
+        for(int row = 1; row < span - 1; row++){
+            cells[(std::size_t(row) * span) + column] = cell(x0 + column - 1, y0 + row - 1);
+        }
+    }
+
+    //step each row of the tile within the world, packing the next states 64 to a word
+    std::fill(result.begin(), result.end(), 0);
+    int rows = std::min(tileSize, height - y0);
+    int columns = std::min(tileSize, width - x0);
+    for(int y = 0; y < rows; y++){
+        const std::uint8_t* above = cells.data() + (std::size_t(y) * span);
+        const std::uint8_t* middle = above + span;
+        const std::uint8_t* below = middle + span;
+        std::uint64_t* out = result.data() + (std::size_t(y) * rowWords);
+        step_row(above, middle, below, columns, rule.get_transitions(), [&](int x, std::uint8_t state){
+            out[x / 64] |= std::uint64_t(state) << (x % 64);
+        });
+    }
+}
+
+/**
+ * OutOfCoreWorld::step(topology)
+ *
+ * Take one step in the world's rule, reading the current generation's tiles and writing the next generation's.
+ *
+ * The tiles are stepped in vertical strips, each as wide as lets four rows of its tiles plus their neighbours fit
+ * in the cache, the three around the row being stepped and the one being prefetched. While a row of a strip is
+ * stepped the prefetch thread reads the row after next. Tiles whose neighbourhood has no occupied tiles are skipped,
+ * unless the rule gives birth to dead cells with no neighbours.
+ *
+ * @example
+ *
+ *      // Step a world on a torus
+ *      world.step(Topology::TORUS);
+ *
+ * @param topology
+ *      Optional parameter. How the edges of the world are joined, Topology::PLANE or Topology::TORUS.
+ *      Defaults to Topology::PLANE.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The topology is not a plane or a torus.
+ *          - A tile cannot be read from or written to the scratch file.
+ */
+void OutOfCoreWorld::step(Topology topology){
+    //exception
+    if(topology != Topology::PLANE && topology != Topology::TORUS){
+        throw std::runtime_error("out of core worlds can only be a plane or a torus");
+    }
+    bool torus = topology == Topology::TORUS;
+    bool births = rule.get_transitions()[0] == 1;
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        queue.clear();
+    }
+
+    //the strip width leaves room in the cache for four rows of its tiles and their neighbours
+    int strip = std::max(1, std::min(tilesX, int(std::min<std::size_t>(capacity / 4, 1 << 20)) - 2));
+    std::vector<std::uint8_t> next(occupied.size(), 0);
+    Tile result(emptyTile->size());
+
+    //gets the indices of a row of tiles across a strip and its neighbours, for prefetching
+    auto strip_row = [&](int ty, int first, int last){
+        std::vector<long long> indices;
+        if(torus){
+            ty = (ty + tilesY) % tilesY;
+        }
+        if(ty < 0 || ty >= tilesY){
+            return indices;
+        }
+        for(int tx = first - 1; tx <= last; tx++){
+            int nx = torus ? (tx + tilesX) % tilesX : tx;
+            if(nx >= 0 && nx < tilesX){
+                indices.push_back(get_tile_index(nx, ty));
+            }
+        }
+        return indices;
+    };
+
+    //gets whether any tile around a tile is occupied
+    auto near_alive = [&](int tx, int ty){
+        for(int dy = -1; dy <= 1; dy++){
+            for(int dx = -1; dx <= 1; dx++){
+                int nx = torus ? (tx + dx + tilesX) % tilesX : tx + dx;
+                int ny = torus ? (ty + dy + tilesY) % tilesY : ty + dy;
+                if(nx >= 0 && ny >= 0 && nx < tilesX && ny < tilesY && occupied[std::size_t(get_tile_index(nx, ny))]){
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    //nested loops over the strips, the rows of each strip and the tiles of each row
+    for(int first = 0; first < tilesX; first += strip){
+        int last = std::min(tilesX, first + strip);
+        prefetch(strip_row(-1, first, last));
+        prefetch(strip_row(0, first, last));
+        prefetch(strip_row(1, first, last));
+        for(int ty = 0; ty < tilesY; ty++){
+            prefetch(strip_row(ty + 2, first, last));
+            for(int tx = first; tx < last; tx++){
+                if(!births && !near_alive(tx, ty)){
+                    continue;
+                }
+                step_tile(tx, ty, torus, result);
+                put_tile(generation + 1, get_tile_index(tx, ty), std::make_shared<const Tile>(result), next);
+            }
+        }
+    }
+    occupied.swap(next);
+    generation++;
+}
+
+/**
+ * OutOfCoreWorld::advance(steps, topology)
+ *
+ * Advance multiple steps, see OutOfCoreWorld::step(topology).
+ *
+ * @param steps
+ *      The number of steps to advance the world forward.
+ *
+ * @param topology
+ *      Optional parameter. How the edges of the world are joined. Defaults to Topology::PLANE.
+ */
+void OutOfCoreWorld::advance(int steps, Topology topology){
+    for(int i = 0; i < steps; i++){
+        step(topology);
+    }
+}
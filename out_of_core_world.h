@@ -0,0 +1,141 @@
+/**
+ * Declares a class representing a world too large to hold in memory, kept in tiles on disk.
+ * Rich documentation for the api and behaviour the OutOfCoreWorld class can be found in out_of_core_world.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+#include "world.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * A TileCounts reports how an OutOfCoreWorld's tile cache has done since the world was made.
+ *      - hits and misses count the tiles the world asked its cache for, and whether they were already loaded.
+ *      - reads and writes count the tiles read from and written to the store on disk, prefetches being the reads
+ *        made ahead of time by the prefetch thread.
+ */
+struct TileCounts {
+    long long hits;
+    long long misses;
+    long long reads;
+    long long writes;
+    long long prefetches;
+};
+
+/**
+ * Declare the structure of the OutOfCoreWorld class for stepping a world kept in tiles in a file.
+ *
+ * The file holds two copies of every tile, one for the current generation and one for the next, each tile being its
+ * rows of cells packed 64 to a word. Only an LRU cache of tiles is kept in memory.
+ */
+class OutOfCoreWorld {
+    private:
+        typedef std::vector<std::uint64_t> Tile;
+
+        /**
+         * A TileKey names the copy of a tile from one generation.
+         */
+        struct TileKey {
+            long long generation;
+            long long index;
+
+            bool operator==(const TileKey& other) const {
+                return generation == other.generation && index == other.index;
+            }
+        };
+
+        /**
+         * The TileKeyHash lets a TileKey be used as a key in std::unordered_map.
+         */
+        struct TileKeyHash {
+            std::size_t operator()(const TileKey& key) const {
+                return std::hash<long long>()((key.index * 0x9E3779B97F4A7C15LL) ^ key.generation);
+            }
+        };
+
+        /**
+         * An Entry is a cached tile and its place in the LRU order.
+         */
+        struct Entry {
+            std::shared_ptr<const Tile> tile;
+            std::list<TileKey>::iterator place;
+        };
+
+        int width;
+        int height;
+        int tileSize;
+        int rowWords;
+        int tilesX;
+        int tilesY;
+        long long generation;
+        Rule rule;
+
+        std::string path;
+        int descriptor;
+        std::size_t tileBytes;
+        std::vector<std::uint8_t> occupied;
+        std::shared_ptr<const Tile> emptyTile;
+
+        std::size_t capacity;
+        bool cacheWrites;
+        std::list<TileKey> recent;
+        std::unordered_map<TileKey, Entry, TileKeyHash> cache;
+        TileCounts counts;
+        std::mutex cacheMutex;
+
+        std::deque<TileKey> queue;
+        bool stopping;
+        std::mutex queueMutex;
+        std::condition_variable queueReady;
+        std::thread prefetcher;
+
+        std::vector<std::uint8_t> cells;
+
+        long long get_tile_index(int tx, int ty) const;
+        std::shared_ptr<const Tile> read_tile(const TileKey& key);
+        void insert_tile(const TileKey& key, std::shared_ptr<const Tile> tile, bool replace);
+        std::shared_ptr<const Tile> get_tile(long long index);
+        void put_tile(long long tile_generation, long long index, std::shared_ptr<const Tile> tile,
+                      std::vector<std::uint8_t>& flags);
+        void prefetch(const std::vector<long long>& indices);
+        void run_prefetcher();
+        void step_tile(int tx, int ty, bool torus, Tile& result);
+
+    public:
+        OutOfCoreWorld(int width, int height, std::string path, std::size_t cache_tiles = 1024, int tile_size = 256);
+        ~OutOfCoreWorld();
+        OutOfCoreWorld(const OutOfCoreWorld&) = delete;
+        OutOfCoreWorld& operator=(const OutOfCoreWorld&) = delete;
+
+        int get_width() const;
+        int get_height() const;
+        int get_tile_size() const;
+        long long get_generation() const;
+        long long get_alive_cells();
+        TileCounts get_counts();
+
+        const Rule& get_rule() const;
+        void set_rule(Rule new_rule);
+
+        void set_cells(const Grid& cells, int x0, int y0);
+        Grid get_cells(int x0, int y0, int x1, int y1);
+
+        void step(Topology topology = Topology::PLANE);
+        void advance(int steps, Topology topology = Topology::PLANE);
+};
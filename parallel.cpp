@@ -0,0 +1,115 @@
+/**
+ * Implements a Parallel namespace with methods for running a search on several threads.
+ *      - The soup, predecessor and collision searches each split their work over a number of threads, which take
+ *        pieces of it as they go, while the calling thread reports how far they have got.
+ *
+ *      - Parallel::run starts the threads, reports progress about once a second from the calling thread, and waits
+ *        for every thread to finish. Without a report the calling thread just waits.
+ *          - An exception thrown by a thread, or by the report, is caught, and the first one is passed on to the
+ *            caller once every thread has finished, like BandPool::run, rather than ending the program.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "parallel.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Parallel::get_threads(threads)
+ *
+ * Gets the number of threads to run with, given the number asked for.
+ *
+ * @param threads
+ *      The number of threads asked for, or 0 or less for one per core.
+ *
+ * @return
+ *      The number of threads, at least 1.
+ */
+int Parallel::get_threads(int threads){
+    return threads > 0 ? threads : int(std::max(1u, std::thread::hardware_concurrency()));
+}
+
+/**
+ * Parallel::run(threads, work, report)
+ *
+ * Run work(thread) on each of a number of threads, and wait for them all to finish.
+ *
+ * @example
+ *
+ *      // Count to a million on four threads, printing how far they have got
+ *      std::atomic<long long> next(0);
+ *      Parallel::run(4, [&](int){
+ *          while(next++ < 1000000){
+ *          }
+ *      }, [&](){
+ *          std::cout << next << std::endl;
+ *      });
+ *
+ * @param threads
+ *      The number of threads to run work on.
+ *
+ * @param work
+ *      The work each thread does, given the thread's index.
+ *
+ * @param report
+ *      Optional parameter. Called from the calling thread about once a second while the threads run.
+ *
+ * @throws
+ *      Whatever the first thread to fail threw, once every thread has finished.
+ */
+void Parallel::run(int threads, const std::function<void(int thread)>& work, const std::function<void()>& report){
+    std::atomic<int> running(threads);
+    std::mutex mutex;
+    std::exception_ptr error;
+
+    std::vector<std::thread> pool;
+    for(int thread = 0; thread < threads; thread++){
+        pool.emplace_back([&, thread](){
+            try{
+                work(thread);
+            }catch(...){
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!error){
+                    error = std::current_exception();
+                }
+            }
+            running--;
+        });
+    }
+
+    //report progress from this thread while the workers run, stopping the reports if one throws
+    bool reporting = bool(report);
+    auto last = std::chrono::steady_clock::now();
+    while(reporting && running > 0){
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        if(std::chrono::steady_clock::now() - last >= std::chrono::seconds(1)){
+            last = std::chrono::steady_clock::now();
+            try{
+                report();
+            }catch(...){
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!error){
+                    error = std::current_exception();
+                }
+                reporting = false;
+            }
+        }
+    }
+    for(std::thread& thread : pool){
+        thread.join();
+    }
+
+    //exception
+    if(error){
+        std::rethrow_exception(error);
+    }
+}
@@ -0,0 +1,136 @@
+/**
+ * Declares a Parallel namespace with methods for running a search on several threads.
+ * Rich documentation for the api and behaviour the Parallel namespace can be found in parallel.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the namespace.
+// #include ...
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Declare the interface of the Parallel namespace for running work on a number of threads while reporting progress.
+ */
+namespace Parallel {
+
+    int get_threads(int threads);
+    void run(int threads, const std::function<void(int thread)>& work, const std::function<void()>& report = nullptr);
+
+    /**
+     * A Finds counts the kinds of thing one thread of a search found, by key, such as the objects left by soups.
+     *      - Each kind keeps a sample from the earliest index it was found at, its count and the earliest few
+     *        indices it was found at, up to kept.
+     *      - Each thread fills its own Finds from indices it takes in increasing order, and the Finds of every
+     *        thread are merged at the end. The merge keeps the earliest sample and indices of each kind, so the
+     *        result is the same however the indices were shared between the threads.
+     */
+    template <typename Key, typename Sample>
+    class Finds {
+        public:
+            struct Find {
+                Sample sample;
+                long long first;
+                long long count;
+                std::vector<long long> indices;
+            };
+
+            explicit Finds(std::size_t kept = 1) : kept(std::max<std::size_t>(kept, 1)) {}
+
+            /**
+             * Count a find of a kind at an index, which adds count to the kind's count. Returns the kind and
+             * whether it is new, in which case the caller fills in its sample.
+             */
+            std::pair<Find&, bool> add(const Key& key, long long index, long long count = 1){
+                auto found = finds.try_emplace(key);
+                Find& find = found.first->second;
+                if(found.second){
+                    find.first = index;
+                    find.count = 0;
+                }
+                find.count += count;
+                if(find.indices.size() < kept && (find.indices.empty() || find.indices.back() != index)){
+                    find.indices.push_back(index);
+                }
+                return {find, found.second};
+            }
+
+            /**
+             * Merge the finds of another thread into these, keeping the earliest sample and indices of each kind.
+             */
+            void merge(Finds& other){
+                for(auto& entry : other.finds){
+                    auto found = finds.find(entry.first);
+                    if(found == finds.end()){
+                        finds.emplace(entry.first, std::move(entry.second));
+                        continue;
+                    }
+                    Find& find = found->second;
+                    Find& theirs = entry.second;
+                    find.count += theirs.count;
+                    if(theirs.first < find.first){
+                        find.sample = std::move(theirs.sample);
+                        find.first = theirs.first;
+                    }
+                    find.indices.insert(find.indices.end(), theirs.indices.begin(), theirs.indices.end());
+                    std::sort(find.indices.begin(), find.indices.end());
+                    find.indices.resize(std::min(find.indices.size(), kept));
+                }
+            }
+
+            /**
+             * Gets every kind found, in order of the earliest index each was found at.
+             */
+            std::vector<Find> list() const{
+                std::vector<Find> listed;
+                for(const auto& entry : finds){
+                    listed.push_back(entry.second);
+                }
+                std::sort(listed.begin(), listed.end(), [](const Find& a, const Find& b){
+                    return a.first < b.first;
+                });
+                return listed;
+            }
+
+        private:
+            std::size_t kept;
+            std::unordered_map<Key, Find> finds;
+    };
+
+    /**
+     * run_chunks(threads, count, chunk, tally, work, report)
+     *
+     * Run work(tally, first, last) over the indices [0, count) on a number of threads, each taking the next chunk
+     * of indices as it finishes the last, and filling its own copy of tally. report(done) is called from the
+     * calling thread about once a second with the number of indices done. Returns the tally of every thread, to be
+     * merged by the caller. Exceptions are passed on as by Parallel::run.
+     */
+    template <typename Tally, typename Work>
+    std::vector<Tally> run_chunks(int threads, long long count, long long chunk, const Tally& tally, const Work& work,
+                                  const std::function<void(long long done)>& report = nullptr){
+        std::atomic<long long> next(0);
+        std::atomic<long long> done(0);
+        std::vector<Tally> tallies(threads, tally);
+        run(threads, [&](int thread){
+            for(long long first = next.fetch_add(chunk); first < count; first = next.fetch_add(chunk)){
+                long long last = std::min(first + chunk, count);
+                work(tallies[thread], first, last);
+                done += last - first;
+            }
+        }, [&](){
+            if(report){
+                report(done);
+            }
+        });
+        return tallies;
+    }
+
+};
@@ -0,0 +1,288 @@
+/**
+ * Implements a Predecessor namespace with methods for searching for the parents of patterns.
+ *      - A parent of a target is a pattern one cell larger on every side whose next generation matches the target
+ *        everywhere inside the target's bounds. Cells outside the target may step to anything.
+ *          - A target with no parent at all is an orphan, and any pattern containing it is a Garden of Eden
+ *            that can only ever appear as a starting state.
+ *
+ *      - The parent is searched for cell by cell in row order, backtracking as soon as a target cell can no longer
+ *        come out right.
+ *          - The parent is held as bitboards, one 64 bit word of cell values and one of which cells are decided
+ *            for each row, so the parent's rows can be at most 64 cells wide.
+ *          - Targets wider than they are tall are rotated first, so rows are as short as possible and mistakes
+ *            are found sooner. Every rule in the Rule class is isotropic, so the rotated parent is still a parent.
+ *          - Each decided cell is checked against the nine target cells whose neighbourhood it lies in, using a
+ *            3x3 consistency table. The table says, for every set of decided cells in a neighbourhood and their
+ *            values, whether the centre can still end up dead and whether it can still end up alive.
+ *          - Dead is tried before alive, so the parents found tend to be sparse.
+ *          - This is simpler than a search that decides a whole parent row at a time and propagates the cells the
+ *            rows above force. A cell is only checked against the 3x3 neighbourhoods around it, so mistakes that
+ *            only show once a later cell is decided are found late. Small targets are searched quickly, but a
+ *            random 16x16 target can take hundreds of millions of cells and most of a minute.
+ *
+ *      - Searches run on every core by default.
+ *          - The first few cells are split into branches, one for each way of setting them, and each thread takes
+ *            the next branch as it finishes.
+ *          - Once a parent is found, later branches are abandoned. Earlier branches still run to the end, so the
+ *            parent found is the first in search order, the same for any number of threads.
+ *          - The number of cells tried is kept for reporting the search rate, and can be limited.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "predecessor.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include "parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+/**
+ * A Board is a partly decided parent, as a word of cell values and a word of decided cells for each row.
+ */
+struct Board {
+    int width;
+    int height;
+    std::vector<std::uint64_t> values;
+    std::vector<std::uint64_t> known;
+};
+
+}
+
+/**
+ * build_table(rule)
+ *
+ * Helper to build the 3x3 consistency table of a rule. The entry at (mask << 9) | values has bit 0 set if a
+ * neighbourhood whose decided cells are mask, with those cells set to values, can step to dead, and bit 1 set if
+ * it can step to alive.
+ */
+static std::vector<std::uint8_t> build_table(const Rule& rule){
+    std::vector<std::uint8_t> table(1 << 18, 0);
+    const std::array<std::uint8_t, 512>& transitions = rule.get_transitions();
+    for(int neighbourhood = 0; neighbourhood < 512; neighbourhood++){
+        int outcome = transitions[neighbourhood] ? 2 : 1;
+        for(int mask = 0; mask < 512; mask++){
+            table[(mask << 9) | (neighbourhood & mask)] |= std::uint8_t(outcome);
+        }
+    }
+    return table;
+}
+
+/**
+ * consistent(board, table, targets, x, y)
+ *
+ * Helper to check the target cells around a newly decided parent cell at x, y can all still come out right.
+ * Target rows are given in parent coordinates less one, so bit x of targets[y] is the target of parent cell
+ * (x + 1, y + 1).
+ */
+static bool consistent(const Board& board, const std::vector<std::uint8_t>& table,
+                       const std::vector<std::uint64_t>& targets, int x, int y){
+    for(int cy = std::max(1, y - 1); cy <= std::min(board.height - 2, y + 1); cy++){
+        for(int cx = std::max(1, x - 1); cx <= std::min(board.width - 2, x + 1); cx++){
+            int values = 0;
+            int mask = 0;
+            for(int k = 0; k < 3; k++){
+                values |= int((board.values[cy - 1 + k] >> (cx - 1)) & 7) << (3 * k);
+                mask |= int((board.known[cy - 1 + k] >> (cx - 1)) & 7) << (3 * k);
+            }
+            int wanted = int((targets[cy - 1] >> (cx - 1)) & 1) + 1;
+            if(!(table[(mask << 9) | values] & wanted)){
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * set_cell(board, i, alive)
+ *
+ * Helper to decide the i-th parent cell in row order.
+ */
+static void set_cell(Board& board, int i, bool alive){
+    int y = i / board.width;
+    std::uint64_t bit = std::uint64_t(1) << (i % board.width);
+    board.values[y] = alive ? (board.values[y] | bit) : (board.values[y] & ~bit);
+    board.known[y] |= bit;
+}
+
+/**
+ * clear_cell(board, i)
+ *
+ * Helper to undecide the i-th parent cell in row order.
+ */
+static void clear_cell(Board& board, int i){
+    int y = i / board.width;
+    std::uint64_t bit = std::uint64_t(1) << (i % board.width);
+    board.values[y] &= ~bit;
+    board.known[y] &= ~bit;
+}
+
+/**
+ * Predecessor::search(target, settings, progress)
+ *
+ * Search for a parent of a target pattern, or prove it has none.
+ *
+ * @example
+ *
+ *      // Look for a parent of a target and check it
+ *      Predecessor::Result result = Predecessor::search(target, Predecessor::Settings());
+ *      if(result.found){
+ *          World world(result.parent);
+ *          world.step();
+ *          bool matches = world.get_state().crop(1, 1, target.get_width() + 1, target.get_height() + 1) == target;
+ *      }
+ *
+ * @param target
+ *      The pattern to find a parent of.
+ *
+ * @param settings
+ *      The rule, threads and cell limit of the search, see Predecessor::Settings.
+ *
+ * @param progress
+ *      Optional parameter. Called from the calling thread about once a second, and once at the end, with the number
+ *      of cells tried and the seconds since the search started.
+ *
+ * @return
+ *      The parent found if there is one, a (width + 2) x (height + 2) grid, with the statistics of the search.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the rule has more than two states, or the target is more than
+ *      62 cells across in both directions.
+ */
+Predecessor::Result Predecessor::search(const Grid& target, const Settings& settings,
+                                        std::function<void(long long nodes, double seconds)> progress){
+    //exception
+    if(settings.rule.get_states() != 2){
+        throw std::runtime_error("rule has more than two states");
+    }
+    //exception
+    if(std::min(target.get_width(), target.get_height()) > 62){
+        throw std::runtime_error("target too large, one side must be at most 62 cells");
+    }
+    auto start = std::chrono::steady_clock::now();
+    bool rotated = target.get_width() > target.get_height();
+    Grid oriented = rotated ? target.rotate(1) : target;
+    int width = oriented.get_width() + 2;
+    int height = oriented.get_height() + 2;
+    int cells = width * height;
+
+    std::vector<std::uint64_t> targets(oriented.get_height(), 0);
+    for(int y = 0; y < oriented.get_height(); y++){
+        for(int x = 0; x < oriented.get_width(); x++){
+            if(oriented(x, y) == Cell::ALIVE){
+                targets[y] |= std::uint64_t(1) << x;
+            }
+        }
+    }
+    std::vector<std::uint8_t> table = build_table(settings.rule);
+
+    //split the first cells into enough branches to keep every thread busy
+    int threads = Parallel::get_threads(settings.threads);
+    int depth = 0;
+    while((1LL << depth) < 64LL * threads && depth < cells && depth < 24){
+        depth++;
+    }
+    const long long branches = 1LL << depth;
+
+    std::atomic<long long> next(0);
+    std::atomic<long long> best(branches);
+    std::atomic<long long> nodes(0);
+    std::atomic<bool> halted(false);
+    std::vector<long long> solutionBranches(threads, -1);
+    std::vector<std::vector<std::uint64_t>> solutions(threads);
+
+    //searches every branch a thread takes until a parent is found in an earlier one
+    auto worker = [&](int thread){
+        Board board = {width, height, std::vector<std::uint64_t>(height, 0), std::vector<std::uint64_t>(height, 0)};
+        std::vector<std::uint8_t> tried(cells, 0);
+        long long counted = 0;
+        for(long long branch = next++; branch < best && !halted; branch = next++){
+            std::fill(board.values.begin(), board.values.end(), 0);
+            std::fill(board.known.begin(), board.known.end(), 0);
+
+            //the bits of the branch decide the first cells, highest bit first so branches follow search order
+            bool valid = true;
+            for(int i = 0; i < depth && valid; i++){
+                set_cell(board, i, (branch >> (depth - 1 - i)) & 1);
+                counted++;
+                valid = consistent(board, table, targets, i % width, i / width);
+            }
+
+            //backtrack over the remaining cells, trying dead then alive for each
+            int i = depth;
+            while(valid && i >= depth){
+                if(i == cells){
+                    solutions[thread] = board.values;
+                    solutionBranches[thread] = branch;
+                    long long current = best;
+                    while(branch < current && !best.compare_exchange_weak(current, branch)){
+                    }
+                    break;
+                }
+                if(tried[i] == 2){
+                    tried[i] = 0;
+                    clear_cell(board, i);
+                    i--;
+                    continue;
+                }
+                set_cell(board, i, tried[i] == 1);
+                tried[i]++;
+                if(consistent(board, table, targets, i % width, i / width)){
+                    i++;
+                }
+
+                //share the count now and then, giving up if an earlier branch found a parent or the limit is hit
+                //the branch's first cells count too, so the count may already be past the threshold here
+                if(++counted >= 4096){
+                    if((nodes += counted) >= settings.limit && settings.limit > 0){
+                        halted = true;
+                    }
+                    counted = 0;
+                    if(halted || best < branch){
+                        break;
+                    }
+                }
+            }
+            std::fill(tried.begin(), tried.end(), 0);
+        }
+        nodes += counted;
+    };
+    auto seconds = [&](){
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    Parallel::run(threads, worker, [&](){
+        if(progress){
+            progress(nodes, seconds());
+        }
+    });
+
+    //the parent of the earliest branch, turned back to the target's orientation
+    Result result = {false, false, Grid(), nodes, branches, seconds()};
+    for(int thread = 0; thread < threads; thread++){
+        if(solutionBranches[thread] >= 0 && solutionBranches[thread] == best){
+            Grid parent(width, height);
+            for(int y = 0; y < height; y++){
+                for(int x = 0; x < width; x++){
+                    if((solutions[thread][y] >> x) & 1){
+                        parent(x, y) = Cell::ALIVE;
+                    }
+                }
+            }
+            result.found = true;
+            result.parent = rotated ? parent.rotate(3) : parent;
+        }
+    }
+    result.exhausted = !result.found && !halted;
+    if(progress){
+        progress(result.nodes, result.seconds);
+    }
+    return result;
+}
@@ -0,0 +1,50 @@
+/**
+ * Declares a Predecessor namespace with methods for searching for the parents of patterns.
+ * Rich documentation for the api and behaviour the Predecessor namespace can be found in predecessor.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the namespace.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+#include <functional>
+
+/**
+ * Declare the interface of the Predecessor namespace for finding a pattern that steps to a target.
+ */
+namespace Predecessor {
+
+    /**
+     * Settings for a predecessor search.
+     *      - threads is the number of threads to search with, or 0 for one per core.
+     *      - limit is the most cells the search may try before giving up, or 0 for no limit.
+     */
+    struct Settings {
+        int threads = 0;
+        long long limit = 0;
+        Rule rule;
+    };
+
+    /**
+     * A Result sums up a predecessor search.
+     *      - found is true if a parent was found, which is then held in parent.
+     *      - exhausted is true if every possible parent was ruled out, so the target has no predecessor at all.
+     *      - nodes is the number of cells tried, and branches the number of pieces the search was split into.
+     */
+    struct Result {
+        bool found;
+        bool exhausted;
+        Grid parent;
+        long long nodes;
+        long long branches;
+        double seconds;
+    };
+
+    Result search(const Grid& target, const Settings& settings,
+                  std::function<void(long long nodes, double seconds)> progress = nullptr);
+
+};
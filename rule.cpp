@@ -0,0 +1,557 @@
+/**
+ * Implements a class representing the rule of a Life-like cellular automaton.
+ *      - Rules are outer-totalistic, the next state of a cell depends on its own state and how many of
+ *        its 8 neighbours are alive.
+ *      - Rules are parsed from B/S notation, e.g. "B3/S23" for Conway's Game of Life or "B36/S23" for HighLife.
+ *          - The digits after B are the neighbour counts that bring a dead cell to life.
+ *          - The digits after S are the neighbour counts that keep an alive cell alive.
+ *          - The older S/B notation without letters, e.g. "23/36", is also accepted.
+ *          - https://www.conwaylife.com/wiki/Rulestring
+ *
+ *      - Rules can be Generations rules, with a third part giving the number of states, e.g. "B2/S/C3" for
+ *        Brian's Brain or "B2/S345/C4" for Star Wars.
+ *          - State 0 is dead and state 1 is alive. An alive cell that does not survive starts dying instead,
+ *            moving through states 2, 3, ... up to (states - 1) one per generation before it is dead.
+ *          - Only alive cells count as neighbours, and dying cells cannot be born.
+ *          - The older S/B/C notation without letters, e.g. "/2/3", is also accepted.
+ *          - Up to 16 states are supported so a cell fits in 4 bits.
+ *          - https://www.conwaylife.com/wiki/Generations
+ *
+ *      - Rules can be isotropic non-totalistic, using Hensel notation to say which arrangements of neighbours
+ *        count as well as how many, e.g. "B2-a/S12" or "B2ce3/S23".
+ *          - Each count from 1 to 7 is followed by letters picking out its arrangements, or by '-' and the letters
+ *            to leave out. A count without letters means every arrangement, as in B/S notation.
+ *          - The letters for each count are, in order, 1 "ce", 2 "cekain", 3 "cekainyqjr", 4 "cekainyqjrtwz",
+ *            and 5 to 7 use the same letters as 3 to 1 for the opposite arrangements.
+ *          - Arrangements that are rotations or reflections of each other share a letter, so rules are isotropic.
+ *          - https://www.conwaylife.com/wiki/Isotropic_non-totalistic_rule
+ *
+ *      - Every rule is compiled into a 512 entry table of the next state for each 3x3 neighbourhood.
+ *          - The neighbourhood index has a bit for each cell, in row order from the top left at bit 0,
+ *            so the centre cell is bit 4.
+ *          - The counts that are born or survive in every arrangement are also kept as bit masks, which World
+ *            expands into a smaller table indexed by neighbour count when the rule is totalistic.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "rule.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <cctype>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+//the bits of a neighbourhood index for the centre cell and for its 8 neighbours
+static const int CENTRE = 1 << 4;
+static const int NEIGHBOURS = 511 ^ CENTRE;
+
+//the Hensel letters for each neighbour count
+static const std::string LETTERS[9] = {"", "ce", "cekain", "cekainyqjr", "cekainyqjrtwz", "cekainyqjr", "cekain", "ce", ""};
+
+//a neighbourhood with the arrangement of each letter for counts 1 to 4, the rest are rotations, reflections or opposites
+static const int REPRESENTATIVES[5][13] = {
+    {0},
+    {1, 2},
+    {5, 10, 33, 3, 40, 68},
+    {69, 42, 98, 11, 7, 13, 97, 70, 14, 41},
+    {325, 170, 99, 15, 45, 71, 101, 102, 106, 43, 105, 78, 108}
+};
+
+/**
+ * count_neighbourhood(neighbourhood)
+ *
+ * Private helper function to count the alive neighbours in a neighbourhood index, ignoring the centre cell.
+ *
+ * @param neighbourhood
+ *      The 9 bit neighbourhood index.
+ *
+ * @return
+ *      The number of alive neighbours, from 0 to 8.
+ */
+static int count_neighbourhood(int neighbourhood){
+    return int(std::bitset<9>(neighbourhood & NEIGHBOURS).count());
+}
+
+/**
+ * transform_neighbourhood(neighbourhood, symmetry)
+ *
+ * Private helper function to rotate and reflect a neighbourhood index.
+ *
+ * @param neighbourhood
+ *      The 9 bit neighbourhood index.
+ *
+ * @param symmetry
+ *      The number of quarter turns clockwise from 0 to 3, plus 4 to mirror the neighbourhood left to right first.
+ *
+ * @return
+ *      The transformed neighbourhood index.
+ */
+static int transform_neighbourhood(int neighbourhood, int symmetry){
+    int result = 0;
+
+    //loop that moves each alive cell to its new position
+    for(int bit = 0; bit < 9; bit++){
+        if(!(neighbourhood & (1 << bit))){
+            continue;
+        }
+        int x = bit % 3;
+        int y = bit / 3;
+        if(symmetry >= 4){
+            x = 2 - x;
+        }
+        for(int turn = 0; turn < symmetry % 4; turn++){
+            int oldX = x;
+            x = 2 - y;
+            y = oldX;
+        }
+        result |= 1 << (x + (3 * y));
+    }
+    return result;
+}
+
+/**
+ * get_representative(n, letter)
+ *
+ * Private helper function to get a neighbourhood index with n alive neighbours in the arrangement of a Hensel letter.
+ *
+ * @param n
+ *      The number of alive neighbours, from 0 to 8.
+ *
+ * @param letter
+ *      The position of the letter in LETTERS[n], or 0 for counts 0 and 8.
+ *
+ * @return
+ *      A neighbourhood index with the centre cell dead.
+ */
+static int get_representative(int n, int letter){
+    if(n == 0 || n == 8){
+        return (n == 8) ? NEIGHBOURS : 0;
+    }
+    return (n <= 4) ? REPRESENTATIVES[n][letter] : (REPRESENTATIVES[8 - n][letter] ^ NEIGHBOURS);
+}
+
+/**
+ * get_letter_table()
+ *
+ * Private helper function to get the position in LETTERS of the Hensel letter for each neighbourhood index.
+ * The table is built the first time it is needed by spreading each representative over its symmetries.
+ *
+ * @return
+ *      A read-only reference to the 512 entry table.
+ */
+static const std::vector<std::uint8_t>& get_letter_table(){
+    static const std::vector<std::uint8_t> table = [](){
+        std::vector<std::uint8_t> letters(512, 0);
+        for(int n = 1; n <= 4; n++){
+            for(std::size_t letter = 0; letter < LETTERS[n].size(); letter++){
+                for(int symmetry = 0; symmetry < 8; symmetry++){
+                    int neighbourhood = transform_neighbourhood(REPRESENTATIVES[n][letter], symmetry);
+                    letters[neighbourhood] = letters[neighbourhood | CENTRE] = std::uint8_t(letter);
+
+                    //counts 5 to 7 use the letters of their opposites, 4 has its own letters for both
+                    if(n < 4){
+                        int opposite = neighbourhood ^ NEIGHBOURS;
+                        letters[opposite] = letters[opposite | CENTRE] = std::uint8_t(letter);
+                    }
+                }
+            }
+        }
+        return letters;
+    }();
+    return table;
+}
+
+/**
+ * parse_neighbourhoods(part, alive, transitions)
+ *
+ * Private helper function to parse the counts and Hensel letters of a B or S part into the transition table.
+ *
+ * @param part
+ *      The part of the rule after its letter, e.g. "2-a3" for B2-a3.
+ *
+ * @param alive
+ *      True for the S part, which sets the neighbourhoods with an alive centre cell.
+ *
+ * @param transitions
+ *      The table to set the neighbourhoods of the part in.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the part has a count that is not a digit from 0 to 8, or a letter
+ *      that count does not have.
+ */
+static void parse_neighbourhoods(const std::string& part, bool alive, std::bitset<512>& transitions){
+    const std::vector<std::uint8_t>& letters = get_letter_table();
+
+    //loop that reads each count with its letters
+    std::size_t i = 0;
+    while(i < part.size()){
+        char digit = part[i++];
+        //exception
+        if(digit < '0' || digit > '8'){
+            throw std::runtime_error("rule counts must be digits from 0 to 8");
+        }
+        int n = digit - '0';
+        bool negated = (i < part.size() && part[i] == '-');
+        if(negated){
+            i++;
+        }
+        std::string chosen;
+        while(i < part.size() && std::isalpha(static_cast<unsigned char>(part[i]))){
+            chosen += char(std::tolower(static_cast<unsigned char>(part[i++])));
+        }
+        //exception
+        if((negated && chosen.empty()) || chosen.find_first_not_of(LETTERS[n]) != std::string::npos){
+            throw std::runtime_error("rule letters must be valid Hensel letters for their count");
+        }
+
+        for(int neighbourhood = 0; neighbourhood < 512; neighbourhood++){
+            if(bool(neighbourhood & CENTRE) != alive || count_neighbourhood(neighbourhood) != n){
+                continue;
+            }
+            bool listed = chosen.find(LETTERS[n][letters[neighbourhood]]) != std::string::npos;
+            if(chosen.empty() || listed != negated){
+                transitions.set(neighbourhood);
+            }
+        }
+    }
+}
+
+/**
+ * Rule::Rule()
+ *
+ * Construct the rule for Conway's Game of Life, B3/S23.
+ *
+ * @example
+ *
+ *      // Make the standard rule
+ *      Rule rule;
+ *
+ */
+Rule::Rule() : Rule("B3/S23"){
+}
+
+/**
+ * Rule::Rule(rule)
+ *
+ * Construct a rule by parsing a rule string in B/S or S/B notation, or B/S/C or S/B/C for Generations rules.
+ * Counts in the B and S halves may be followed by Hensel letters for isotropic non-totalistic rules.
+ * Letters may be upper or lower case, and the B and S halves may be empty.
+ *
+ * @example
+ *
+ *      // Make the HighLife rule
+ *      Rule highlife("B36/S23");
+ *
+ *      // Make the Day & Night rule
+ *      Rule day_and_night("B3678/S34678");
+ *
+ *      // Make Conway's Game of Life in S/B notation
+ *      Rule life("23/3");
+ *
+ *      // Make Brian's Brain, a Generations rule with 3 states
+ *      Rule brians_brain("B2/S/C3");
+ *
+ *      // Make an isotropic non-totalistic rule, born with 2 neighbours in any arrangement except 2a
+ *      Rule isotropic("B2-a/S12");
+ *
+ * @param rule
+ *      The rule string to parse.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The rule does not have two or three parts separated by '/'.
+ *          - A part starts with a letter other than B, S, or C, or a letter is repeated.
+ *          - A B or S part contains anything other than the digits 0 to 8 and valid Hensel letters for each digit.
+ *          - The number of states is not between 2 and 16.
+ *          - A Generations rule is not totalistic.
+ */
+Rule::Rule(std::string rule){
+    //split the rule into its parts
+    std::vector<std::string> parts;
+    std::size_t start = 0;
+    for(std::size_t slash = rule.find('/'); slash != std::string::npos; slash = rule.find('/', start)){
+        parts.push_back(rule.substr(start, slash - start));
+        start = slash + 1;
+    }
+    parts.push_back(rule.substr(start));
+    //exception
+    if(parts.size() < 2 || parts.size() > 3){
+        throw std::runtime_error("rule must have two or three parts separated by '/'");
+    }
+
+    //without letters the older S/B/C order is used
+    bool lettered = false;
+    for(const std::string& part : parts){
+        lettered = lettered || (!part.empty() && std::isalpha(static_cast<unsigned char>(part[0])));
+    }
+    std::string order = "sbc";
+    this->states = 2;
+    this->transitions.reset();
+    std::string seen;
+
+    //loop that reads the counts out of each part
+    for(std::size_t p = 0; p < parts.size(); p++){
+        std::string part = parts[p];
+        char letter = order[p];
+        if(lettered){
+            //exception
+            if(part.empty() || std::string("bscg").find(char(std::tolower(static_cast<unsigned char>(part[0])))) == std::string::npos){
+                throw std::runtime_error("rule part must start with B, S, or C");
+            }
+            letter = char(std::tolower(static_cast<unsigned char>(part[0])));
+            letter = (letter == 'g') ? 'c' : letter;
+            part = part.substr(1);
+        }
+        //exception
+        if(seen.find(letter) != std::string::npos){
+            throw std::runtime_error("rule must have one B part and one S part");
+        }
+        seen += letter;
+
+        if(letter == 'c'){
+            //exception
+            if(part.empty() || part.size() > 2 || part.find_first_not_of("0123456789") != std::string::npos ||
+                std::stoi(part) < 2 || std::stoi(part) > 16){
+                throw std::runtime_error("rule states must be a number from 2 to 16");
+            }
+            this->states = std::stoi(part);
+            continue;
+        }
+        parse_neighbourhoods(part, letter == 's', transitions);
+    }
+    //exception
+    if(seen.find('b') == std::string::npos || seen.find('s') == std::string::npos){
+        throw std::runtime_error("rule must have one B part and one S part");
+    }
+
+    //the counts that are born or survive in every arrangement, the rule is totalistic if no count is partly set
+    this->birth = 0;
+    this->survival = 0;
+    this->totalistic = true;
+    for(int centre = 0; centre <= CENTRE; centre += CENTRE){
+        int all[9] = {0};
+        int set[9] = {0};
+        for(int neighbourhood = 0; neighbourhood < 512; neighbourhood++){
+            if((neighbourhood & CENTRE) != centre){
+                continue;
+            }
+            int n = count_neighbourhood(neighbourhood);
+            all[n]++;
+            set[n] += transitions[neighbourhood];
+        }
+        for(int n = 0; n <= 8; n++){
+            std::uint16_t& mask = centre ? survival : birth;
+            mask |= std::uint16_t((set[n] == all[n]) << n);
+            totalistic = totalistic && (set[n] == 0 || set[n] == all[n]);
+        }
+    }
+    //exception
+    if(!totalistic && states > 2){
+        throw std::runtime_error("Generations rules must be totalistic");
+    }
+    for(int neighbourhood = 0; neighbourhood < 512; neighbourhood++){
+        packed[neighbourhood] = transitions[neighbourhood] ? 1 : 0;
+    }
+    set_name();
+}
+
+/**
+ * Rule::set_name()
+ *
+ * Private helper function to write the rule string from the transition table in the usual B/S/C order.
+ * Each count is listed with the letters of its arrangements, or with '-' and the letters left out when that
+ * is shorter, or on its own when every arrangement is included.
+ */
+void Rule::set_name(){
+    this->name = "";
+
+    //loop that lists the counts of the B then the S half
+    for(int centre = 0; centre <= CENTRE; centre += CENTRE){
+        name += centre ? "/S" : "B";
+        for(int n = 0; n <= 8; n++){
+            //counts 0 and 8 have a single arrangement without a letter
+            if(LETTERS[n].empty()){
+                if(transitions[get_representative(n, 0) | centre]){
+                    name += char('0' + n);
+                }
+                continue;
+            }
+            std::string chosen;
+            std::string missing;
+            for(std::size_t letter = 0; letter < LETTERS[n].size(); letter++){
+                (transitions[get_representative(n, int(letter)) | centre] ? chosen : missing) += LETTERS[n][letter];
+            }
+            if(chosen.empty()){
+                continue;
+            }
+            name += char('0' + n);
+            if(!missing.empty()){
+                name += (chosen.size() <= missing.size()) ? chosen : "-" + missing;
+            }
+        }
+    }
+    if(states > 2){
+        this->name += "/C" + std::to_string(states);
+    }
+}
+
+/**
+ * Rule::get_name()
+ *
+ * Gets the rule string in B/S notation with the counts in order, e.g. "B36/S23".
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The name of the rule.
+ */
+std::string Rule::get_name() const{
+    return this->name;
+}
+
+/**
+ * Rule::is_standard()
+ *
+ * Checks if this is the B3/S23 rule of Conway's Game of Life, which World has a specialised step for.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      Returns true if the rule is B3/S23.
+ */
+bool Rule::is_standard() const{
+    return birth == (1 << 3) && survival == ((1 << 2) | (1 << 3)) && states == 2 && totalistic;
+}
+
+/**
+ * Rule::is_totalistic()
+ *
+ * Checks if the next state of a cell depends only on how many neighbours are alive and not on their arrangement,
+ * so the rule can be written in B/S notation without Hensel letters.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      Returns true if the rule is totalistic.
+ */
+bool Rule::is_totalistic() const{
+    return this->totalistic;
+}
+
+/**
+ * Rule::get_states()
+ *
+ * Gets the number of states a cell can be in, 2 for Life-like rules or more for Generations rules.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of states.
+ */
+int Rule::get_states() const{
+    return this->states;
+}
+
+/**
+ * Rule::get_transition(cell, neighbours)
+ *
+ * Gets the next state of a cell from its current state and number of alive neighbours.
+ * For Generations rules this gives the birth and survival part of the rule only, an alive cell
+ * that does not survive is returned as Cell::DEAD.
+ * For non-totalistic rules a cell is only Cell::ALIVE if it would be for every arrangement of its neighbours.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // A dead cell with 6 neighbours is born in HighLife
+ *      Cell cell = Rule("B36/S23").get_transition(Cell::DEAD, 6);
+ *
+ * @param cell
+ *      The current state of the cell.
+ *
+ * @param neighbours
+ *      The number of alive neighbours, from 0 to 8.
+ *
+ * @return
+ *      The state of the cell in the next generation.
+ */
+Cell Rule::get_transition(Cell cell, int neighbours) const{
+    std::uint16_t mask = (cell == Cell::ALIVE) ? survival : birth;
+    return (mask & (1 << neighbours)) ? Cell::ALIVE : Cell::DEAD;
+}
+
+/**
+ * Rule::get_transition(neighbourhood)
+ *
+ * Gets the next state of a cell from the arrangement of alive cells in its 3x3 neighbourhood.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // A dead cell with alive neighbours at the top left and top right (2c) is born in B2-a/S12
+ *      Cell cell = Rule("B2-a/S12").get_transition((1 << 0) | (1 << 2));
+ *
+ * @param neighbourhood
+ *      A 9 bit index with a bit set for each alive cell, in row order from the top left cell at bit 0
+ *      to the bottom right cell at bit 8, so the cell itself is bit 4.
+ *
+ * @return
+ *      The state of the cell in the next generation.
+ */
+Cell Rule::get_transition(int neighbourhood) const{
+    return transitions[neighbourhood & 511] ? Cell::ALIVE : Cell::DEAD;
+}
+
+/**
+ * Rule::get_transitions()
+ *
+ * Gets the rule's transitions packed into a table with a byte of 1 for every neighbourhood index that steps to alive
+ * and 0 for the rest, indexed as in Rule::get_transition(neighbourhood), for kernels such as step_row.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Step a row of 8 cells, given the rows above, through and below it with a cell either side
+ *      std::uint8_t next[8];
+ *      step_row(above, centre, below, 8, rule.get_transitions(), [&](int i, std::uint8_t state){
+ *          next[i] = state;
+ *      });
+ *
+ * @return
+ *      The table of next states, from 0 to 511.
+ */
+const std::array<std::uint8_t, 512>& Rule::get_transitions() const{
+    return packed;
+}
+
+/**
+ * Rule::get_next_state(state, neighbours)
+ *
+ * Gets the next state of a cell in a Generations rule from its current state and number of alive neighbours.
+ * State 0 is dead, state 1 is alive and states 2 and up are dying. For two state rules this is the same as
+ * Rule::get_transition(cell, neighbours) with states 0 and 1 standing for Cell::DEAD and Cell::ALIVE.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // An alive cell in Brian's Brain always starts dying, so this is 2
+ *      int state = Rule("B2/S/C3").get_next_state(1, 3);
+ *
+ * @param state
+ *      The current state of the cell, from 0 to Rule::get_states() - 1.
+ *
+ * @param neighbours
+ *      The number of alive (state 1) neighbours, from 0 to 8.
+ *
+ * @return
+ *      The state of the cell in the next generation.
+ */
+int Rule::get_next_state(int state, int neighbours) const{
+    if(state == 0){
+        return (birth & (1 << neighbours)) ? 1 : 0;
+    }
+    if(state == 1 && (survival & (1 << neighbours))){
+        return 1;
+    }
+    //dying cells age by one state each generation until they wrap back round to dead
+    return (state + 1) % states;
+}
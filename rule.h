@@ -0,0 +1,65 @@
+/**
+ * Declares a class representing the rule of a Life-like cellular automaton.
+ * Rich documentation for the api and behaviour the Rule class can be found in rule.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include <string>
+#include <cstdint>
+#include <array>
+#include <bitset>
+
+/**
+ * Declare the structure of the Rule class for representing which cells are born and which survive,
+ * and for Generations rules how many states a dying cell passes through.
+ */
+class Rule {
+    private:
+        std::string name;
+        std::uint16_t birth;
+        std::uint16_t survival;
+        int states;
+        std::bitset<512> transitions;
+        std::array<std::uint8_t, 512> packed;
+        bool totalistic;
+
+        void set_name();
+    public:
+        Rule();
+        explicit Rule(std::string rule);
+
+        std::string get_name() const;
+        bool is_standard() const;
+        bool is_totalistic() const;
+        int get_states() const;
+        Cell get_transition(Cell cell, int neighbours) const;
+        Cell get_transition(int neighbourhood) const;
+        const std::array<std::uint8_t, 512>& get_transitions() const;
+        int get_next_state(int state, int neighbours) const;
+};
+
+/**
+ * step_row(above, centre, below, count, transitions, write)
+ *
+ * Steps a row of cells held as bytes of 0 or 1, calling write(i, state) with the next state, 0 or 1, of each of the
+ * count cells in order. The three rows start one cell before the first cell stepped, so each holds count + 2 bytes.
+ * The index of each cell's 3x3 neighbourhood slides along the row, the columns already in it shifting one place
+ * and only the new right hand column being read, and is looked up in a table from Rule::get_transitions().
+ */
+template <typename Write>
+inline void step_row(const std::uint8_t* above, const std::uint8_t* centre, const std::uint8_t* below, int count,
+                     const std::array<std::uint8_t, 512>& transitions, const Write& write){
+    int neighbourhood = (above[0] << 1) | (centre[0] << 4) | (below[0] << 7) |
+                        (above[1] << 2) | (centre[1] << 5) | (below[1] << 8);
+    for(int i = 0; i < count; i++){
+        neighbourhood = ((neighbourhood >> 1) & 0xDB) |
+                        (above[i + 2] << 2) | (centre[i + 2] << 5) | (below[i + 2] << 8);
+        write(i, transitions[neighbourhood]);
+    }
+}
@@ -0,0 +1,198 @@
+/**
+ * Implements a Search namespace with methods for locating patterns inside larger Grid objects.
+ *      - Patterns are matched in all eight orientations reachable with Grid::rotate and Grid::reflect.
+ *          - Orientations that look the same (like the four rotations of a block) are only searched once.
+ *
+ *      - A pattern matches when every cell of its bounding box, alive or dead, equals the cell underneath it.
+ *
+ *      - Grids are searched as packed rows of 64 bit words, one bit per cell.
+ *          - Each needle cell is compared against 64 neighbouring candidate positions at once by shifting
+ *            the haystack row and combining the results with bitwise and.
+ *          - Alive needle cells are compared first and a group of candidates is abandoned as soon as
+ *            none of them can still match.
+ *
+ *      - Searches can be split across threads by bands of rows, giving the same matches for any thread count.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "search.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <array>
+#include <thread>
+
+/**
+ * pack_rows(grid, stride, words, y0, y1)
+ *
+ * Helper to pack the rows [y0, y1) of a grid into a buffer holding stride words per row.
+ */
+static void pack_rows(const Grid& grid, int stride, std::vector<std::uint64_t>& words, int y0, int y1){
+    for(int y = y0; y < y1; y++){
+        grid.pack_row(y, words.data() + (std::size_t(y) * stride));
+    }
+}
+
+/**
+ * search_rows(haystack, stride, width, needle, lastX, y0, y1, match, matches)
+ *
+ * Helper to find every window with its top edge in rows [y0, y1) that matches one orientation of the needle.
+ * The needle is given as a list of its cells, each as (row, column, alive), and lastX is the largest x where it fits.
+ * Each candidate word covers 64 horizontally adjacent positions, with bit b standing for x = 64 * k + b.
+ */
+static void search_rows(const std::vector<std::uint64_t>& haystack, int stride,
+                        const std::vector<std::array<int, 3>>& needle, int lastX,
+                        int y0, int y1, Search::Match match, std::vector<Search::Match>& matches){
+    int candidateWords = (lastX / 64) + 1;
+
+    for(int y = y0; y < y1; y++){
+        const std::uint64_t* rows = haystack.data() + (std::size_t(y) * stride);
+        for(int k = 0; k < candidateWords; k++){
+            //only positions where the whole needle fits in the haystack are candidates
+            int valid = lastX - (k * 64);
+            std::uint64_t mask = (valid >= 63) ? ~std::uint64_t(0) : ((std::uint64_t(1) << (valid + 1)) - 1);
+
+            //compare each needle cell against the haystack shifted under it, stopping once nothing can match
+            for(std::size_t i = 0; i < needle.size() && mask; i++){
+                const std::uint64_t* row = rows + (std::size_t(needle[i][0]) * stride) + k + (needle[i][1] / 64);
+                int s = needle[i][1] % 64;
+                std::uint64_t shifted = s ? ((row[0] >> s) | (row[1] << (64 - s))) : row[0];
+                mask &= needle[i][2] ? shifted : ~shifted;
+            }
+
+            //every bit left in the mask is a match
+            while(mask){
+                match.x = (k * 64) + __builtin_ctzll(mask);
+                match.y = y;
+                matches.push_back(match);
+                mask &= mask - 1;
+            }
+        }
+    }
+}
+
+/**
+ * Search::find_pattern(haystack, needle, threads = 1)
+ *
+ * Find every occurrence of a pattern inside a grid, in any rotation or reflection.
+ * The needle matches a window of the haystack when all of its cells, alive and dead, are equal.
+ * Matches are returned sorted by y, then x, then orientation, whatever the number of threads.
+ *
+ * @example
+ *
+ *      // Make a large grid with some gliders in it
+ *      Grid grid(1024);
+ *      grid.merge(Zoo::glider(), 10, 10);
+ *      grid.merge(Zoo::glider().rotate(2), 500, 700);
+ *
+ *      // Find the gliders using 8 threads
+ *      for (Search::Match match : Search::find_pattern(grid, Zoo::glider(), 8)) {
+ *          std::cout << match.x << ", " << match.y << std::endl;
+ *      }
+ *
+ * @param haystack
+ *      The grid to search in.
+ *
+ * @param needle
+ *      The pattern to search for.
+ *
+ * @param threads
+ *      Optional parameter. The number of threads to split the rows of the haystack between. Defaults to 1.
+ *
+ * @return
+ *      Returns a list of all the matches found.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the needle is empty.
+ */
+std::vector<Search::Match> Search::find_pattern(const Grid& haystack, const Grid& needle, int threads){
+    //exception
+    if(needle.get_width() < 1 || needle.get_height() < 1){
+        throw std::runtime_error("needle is empty");
+    }
+    threads = std::max(threads, 1);
+
+    //nested loops that collect each distinct orientation of the needle
+    std::vector<Grid> orientations;
+    std::vector<Match> kinds;
+    for(int reflected = 0; reflected < 2; reflected++){
+        Grid base = reflected ? needle.reflect() : needle.rotate(0);
+        for(int rotation = 0; rotation < 4; rotation++){
+            Grid oriented = base.rotate(rotation);
+            bool seen = false;
+            for(const Grid& other : orientations){
+                seen = seen || (other == oriented);
+            }
+            if(!seen){
+                orientations.push_back(oriented);
+                kinds.push_back({0, 0, rotation, reflected == 1});
+            }
+        }
+    }
+
+    //pack the haystack with a spare word on every row so shifts can always read one word ahead
+    int width = haystack.get_width();
+    int height = haystack.get_height();
+    int stride = haystack.get_row_words() + 1;
+    std::vector<std::uint64_t> packed(std::size_t(stride) * height, 0);
+    std::vector<std::thread> workers;
+    for(int t = 0; t < threads; t++){
+        int y0 = (height * t) / threads;
+        int y1 = (height * (t + 1)) / threads;
+        workers.emplace_back(pack_rows, std::cref(haystack), stride, std::ref(packed), y0, y1);
+    }
+    for(std::thread& worker : workers){
+        worker.join();
+    }
+    workers.clear();
+
+    //each thread searches every orientation over its own band of rows
+    std::vector<std::vector<Match>> found(threads);
+    for(int t = 0; t < threads; t++){
+        workers.emplace_back([&, t](){
+            for(std::size_t i = 0; i < orientations.size(); i++){
+                const Grid& oriented = orientations[i];
+                int needleWidth = oriented.get_width();
+                int needleHeight = oriented.get_height();
+                if(needleWidth > width || needleHeight > height){
+                    continue;
+                }
+
+                /*list the needle cells with the alive ones first, on mostly empty boards they rule out
+                almost every candidate straight away*/
+                std::vector<std::array<int, 3>> cells;
+                for(int alive = 1; alive >= 0; alive--){
+                    for(int r = 0; r < needleHeight; r++){
+                        for(int c = 0; c < needleWidth; c++){
+                            if((oriented(c, r) == Cell::ALIVE) == (alive == 1)){
+                                cells.push_back({r, c, alive});
+                            }
+                        }
+                    }
+                }
+
+                int rows = (height - needleHeight) + 1;
+                int y0 = (rows * t) / threads;
+                int y1 = (rows * (t + 1)) / threads;
+                search_rows(packed, stride, cells, width - needleWidth, y0, y1, kinds[i], found[t]);
+            }
+        });
+    }
+    for(std::thread& worker : workers){
+        worker.join();
+    }
+
+    std::vector<Match> matches;
+    for(const std::vector<Match>& band : found){
+        matches.insert(matches.end(), band.begin(), band.end());
+    }
+    std::sort(matches.begin(), matches.end(), [](const Match& a, const Match& b){
+        if(a.y != b.y){return a.y < b.y;}
+        if(a.x != b.x){return a.x < b.x;}
+        if(a.reflected != b.reflected){return b.reflected;}
+        return a.rotation < b.rotation;
+    });
+    return matches;
+}
@@ -0,0 +1,35 @@
+/**
+ * Declares a Search namespace with methods for locating patterns inside larger Grid objects.
+ * Rich documentation for the api and behaviour the Search namespace can be found in search.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the namespace.
+// #include ...
+#include "grid.h"
+#include <vector>
+
+/**
+ * Declare the interface of the Search namespace for finding patterns within grids.
+ */
+namespace Search {
+
+    /**
+     * A Match is one place a pattern was found.
+     *      - x, y is the top left corner of the matched window in the searched grid.
+     *      - The pattern was matched after being reflected (if reflected is true) and then
+     *        rotated by rotation steps of 90 degrees, as in needle.reflect().rotate(rotation).
+     */
+    struct Match {
+        int x;
+        int y;
+        int rotation;
+        bool reflected;
+    };
+
+    std::vector<Match> find_pattern(const Grid& haystack, const Grid& needle, int threads = 1);
+
+};
@@ -0,0 +1,571 @@
+/**
+ * Implements a Soup namespace with methods for running random soup searches.
+ *      - A soup is a small square of random cells, each alive with a chance of one half.
+ *          - Soups are made from a seed and an index with a counter based generator, so every soup can be made
+ *            again on its own, in any order and on any thread.
+ *          - The same generator fills grids of any size at any density in parallel over bands of rows, and can
+ *            make them symmetric.
+ *
+ *      - A search runs many soups and censuses what each one settles down to.
+ *          - Each soup is placed in the middle of a larger torus, so gliders and spaceships keep flying instead of
+ *            crashing into an edge, and the world settles into a still life or oscillator that includes them.
+ *          - Soups in totalistic rules are run 64 at a time as one block of a SoupBatch, one soup per bit, until
+ *            each has repeated an earlier generation. This catches any period, including a glider going all the
+ *            way around the torus.
+ *          - Soups in other rules are run one at a time with World::advance_until_stable, looking for periods up
+ *            to 4 times the world size.
+ *          - Soups that do not settle within the generation limit are counted and reported separately.
+ *          - Before the census the torus is rolled so an empty row and column lie along its edges, so objects
+ *            that were crossing the edges are not cut in half.
+ *          - The census uses Census::take, and names objects from a Census::Table.
+ *
+ *      - Searches run on every core by default, each thread taking the next 64 soups as it finishes.
+ *          - Each thread keeps its own tally of objects, merged once every soup is done, so threads never wait.
+ *          - A progress function can be given to report the number of soups done while the search runs.
+ *
+ *      - Reports list every object found with its count, and draw the rare objects found in only a few soups
+ *        along with the soups they came from.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "soup.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include "world.h"
+#include "parallel.h"
+#include "soup_batch.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+/**
+ * mix(value)
+ *
+ * Helper to scramble a 64 bit value so that nearby inputs give unrelated outputs, the finaliser of splitmix64.
+ */
+static std::uint64_t mix(std::uint64_t value){
+    value += 0x9e3779b97f4a7c15ULL;
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+}
+
+/**
+ * roll(grid)
+ *
+ * Helper to shift a toroidal grid so that one of its empty columns ends up as the last column and one of its
+ * empty rows as the last row. Grids without an empty row and column are returned as they are.
+ */
+static Grid roll(const Grid& grid){
+    int width = grid.get_width();
+    int height = grid.get_height();
+    std::vector<bool> usedColumns(width, false);
+    std::vector<bool> usedRows(height, false);
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            if(grid(x, y) == Cell::ALIVE){
+                usedColumns[x] = true;
+                usedRows[y] = true;
+            }
+        }
+    }
+    int emptyColumn = int(std::find(usedColumns.begin(), usedColumns.end(), false) - usedColumns.begin());
+    int emptyRow = int(std::find(usedRows.begin(), usedRows.end(), false) - usedRows.begin());
+    if(emptyColumn == width || emptyRow == height){
+        return grid;
+    }
+
+    Grid rolled(width, height);
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            rolled(x, y) = grid((x + emptyColumn + 1) % width, (y + emptyRow + 1) % height);
+        }
+    }
+    return rolled;
+}
+
+/**
+ * run_in_bands(threads, count, work)
+ *
+ * Helper to split the range [0, count) into one band per thread and run work(begin, end) on each.
+ * A single band is run on the calling thread.
+ */
+template <typename Work>
+static void run_in_bands(int threads, int count, Work work){
+    if(threads == 1){
+        work(0, count);
+        return;
+    }
+    Parallel::run(threads, [&](int t){
+        int begin = int((std::int64_t(count) * t) / threads);
+        int end = int((std::int64_t(count) * (t + 1)) / threads);
+        work(begin, end);
+    });
+}
+
+namespace {
+
+/**
+ * A Tally is the objects, by name, and the unsettled soups found by one thread of a search.
+ */
+struct Tally {
+    Parallel::Finds<std::string, Census::Object> finds;
+    Parallel::Finds<bool, bool> unstable;
+};
+
+}
+
+/**
+ * Soup::fill(grid, seed, density, symmetry, threads)
+ *
+ * Overwrite every cell of a grid with random cells, each alive with the given chance, then make it symmetric.
+ *      - Cells come from a counter based generator, where each group of 64 cells in a row takes its bits from the
+ *        hash of the seed, the row and the group. Rows can be filled in any order on any thread, so the same seed
+ *        always gives the same grid whatever the number of threads.
+ *      - The density is rounded to a multiple of 1/65536. Each group combines one random word for each binary
+ *        digit of the density from the lowest set digit up, or-ing for a 1 and and-ing for a 0, so a density of
+ *        one half takes one word per 64 cells and any other at most 16.
+ *      - The random bits are spread out to cells 8 at a time with a table of 8 cell patterns.
+ *      - Symmetry is made afterwards by copying the cells of one part of the grid over the rest, in passes over
+ *        bands of rows.
+ *
+ * @example
+ *
+ *      // Fill a board with cells at a density of 3/8 that looks the same turned a quarter of the way round
+ *      Grid grid(32768, 32768);
+ *      Soup::fill(grid, 42, 0.375, Soup::Symmetry::C4);
+ *
+ * @param grid
+ *      The grid to fill, whose size is kept.
+ *
+ * @param seed
+ *      The seed of the fill.
+ *
+ * @param density
+ *      Optional parameter. The chance of each cell being alive, from 0 to 1, defaults to one half.
+ *
+ * @param symmetry
+ *      Optional parameter. The symmetry to make the grid with, see Soup::Symmetry, defaults to none.
+ *
+ * @param threads
+ *      Optional parameter. The number of threads to fill with, or 0 for one per core.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the density is not from 0 to 1, or the symmetry needs a
+ *      square grid and the grid is not square.
+ */
+void Soup::fill(Grid& grid, std::uint64_t seed, double density, Symmetry symmetry, int threads){
+    //exception
+    if(!(density >= 0 && density <= 1)){
+        throw std::runtime_error("density must be from 0 to 1");
+    }
+    int width = grid.get_width();
+    int height = grid.get_height();
+    //exception
+    if((symmetry == Symmetry::C4 || symmetry == Symmetry::D8) && width != height){
+        throw std::runtime_error("symmetry needs a square grid");
+    }
+    if(width == 0 || height == 0){
+        return;
+    }
+    threads = Parallel::get_threads(threads);
+    threads = std::min(threads, height);
+
+    //8 cell patterns for every byte of random bits, lowest bit first
+    static const std::array<std::uint64_t, 256> patterns = [](){
+        std::array<std::uint64_t, 256> table;
+        for(int byte = 0; byte < 256; byte++){
+            std::uint64_t pattern = 0;
+            for(int bit = 0; bit < 8; bit++){
+                pattern |= std::uint64_t(std::uint8_t(((byte >> bit) & 1) ? Cell::ALIVE : Cell::DEAD)) << (8 * bit);
+            }
+            table[byte] = pattern;
+        }
+        return table;
+    }();
+
+    int digits = int(std::llround(density * 65536));
+    int lowest = (digits == 0 || digits == 65536) ? 16 : __builtin_ctz(unsigned(digits));
+    int groups = (width + 63) / 64;
+    std::uint64_t base = mix(seed);
+
+    //fill bands of rows, a group of 64 cells at a time
+    run_in_bands(threads, height, [&](int y0, int y1){
+        Cell group[64];
+        for(int y = y0; y < y1; y++){
+            Cell* row = &grid(0, y);
+            for(int k = 0; k < groups; k++){
+                std::uint64_t counter = ((std::uint64_t(y) * groups) + k) * 16;
+                std::uint64_t bits = (digits == 65536) ? ~std::uint64_t(0) : 0;
+                if(lowest < 16){
+                    bits = mix(base + counter);
+                }
+                for(int digit = lowest + 1; digit < 16; digit++){
+                    std::uint64_t word = mix(base + counter + std::uint64_t(digit));
+                    bits = ((digits >> digit) & 1) ? (bits | word) : (bits & word);
+                }
+                for(int byte = 0; byte < 8; byte++){
+                    std::memcpy(group + (8 * byte), &patterns[(bits >> (8 * byte)) & 0xFF], 8);
+                }
+                int count = std::min(64, width - (64 * k));
+                std::memcpy(row + (64 * k), group, std::size_t(count));
+            }
+        }
+    });
+
+    /*the rows follow one another in memory, so the passes that work across rows index the cells directly,
+    going through large square tiles so each page of memory is visited as few times as possible*/
+    Cell* cells = &grid(0, 0);
+    const int side = 256;
+
+    //copies the left half of each row over the right half, mirrored
+    auto mirror_rows = [&](int y0, int y1){
+        for(int y = y0; y < y1; y++){
+            Cell* row = &grid(0, y);
+            std::reverse_copy(row, row + (width / 2), row + ((width + 1) / 2));
+        }
+    };
+    //copies the top half of the rows over the bottom half, mirrored
+    auto mirror_columns = [&](int y0, int y1){
+        for(int y = std::max(y0, (height + 1) / 2); y < y1; y++){
+            const Cell* source = &grid(0, height - 1 - y);
+            std::copy(source, source + width, &grid(0, y));
+        }
+    };
+    //copies the top half of the rows over the bottom half turned half way round, mirroring the middle row
+    auto turn_half = [&](int y0, int y1){
+        for(int y = std::max(y0, height / 2); y < y1; y++){
+            Cell* row = &grid(0, y);
+            if(height - 1 - y < y){
+                const Cell* source = &grid(0, height - 1 - y);
+                std::reverse_copy(source, source + width, row);
+            }
+            else{
+                std::reverse_copy(row, row + (width / 2), row + ((width + 1) / 2));
+            }
+        }
+    };
+    //copies the top left quarter over the other three, turned a quarter of the way round each time
+    auto turn_quarter = [&](int y0, int y1){
+        std::vector<Cell> tile(std::size_t(side) * side);
+        std::vector<Cell> turned(std::size_t(side) * side);
+        y1 = std::min(y1, width / 2);
+        for(int ty = y0; ty < y1; ty += side){
+            for(int tx = 0; tx < (width + 1) / 2; tx += side){
+                //copy a tile out then write it back a row at a time, so the turned copies never read down columns
+                int rows = std::min(side, y1 - ty);
+                int columns = std::min(side, ((width + 1) / 2) - tx);
+                for(int j = 0; j < rows; j++){
+                    std::memcpy(&tile[j * side], cells + (std::size_t(ty + j) * width) + tx, std::size_t(columns));
+                }
+                for(int j = 0; j < rows; j++){
+                    for(int i = 0; i < columns; i++){
+                        turned[(i * side) + j] = tile[(j * side) + i];
+                    }
+                }
+                for(int i = 0; i < columns; i++){
+                    Cell* right = cells + (std::size_t(tx + i) * width) + (width - ty - rows);
+                    std::reverse_copy(&turned[i * side], &turned[i * side] + rows, right);
+                    Cell* left = cells + (std::size_t(width - 1 - tx - i) * width) + ty;
+                    std::memcpy(left, &turned[i * side], std::size_t(rows));
+                }
+                for(int j = 0; j < rows; j++){
+                    Cell* bottom = cells + (std::size_t(width - 1 - ty - j) * width) + (width - tx - columns);
+                    std::reverse_copy(&tile[j * side], &tile[j * side] + columns, bottom);
+                }
+            }
+        }
+    };
+    //copies the top left quarter above its diagonal over the part below it
+    auto mirror_diagonal = [&](int y0, int y1){
+        std::vector<Cell> tile(std::size_t(side) * side);
+        y1 = std::min(y1, (width + 1) / 2);
+        for(int ty = y0; ty < y1; ty += side){
+            int rows = std::min(side, y1 - ty);
+            for(int tx = 0; tx < ty + rows; tx += side){
+                //copy the part of the mirrored tile above the diagonal out, then write it back a row at a time
+                int columns = std::min(side, ty + rows - tx);
+                for(int i = 0; i < columns; i++){
+                    int first = std::max(0, tx + i + 1 - ty);
+                    if(first < rows){
+                        std::memcpy(&tile[(i * side) + first], cells + ((std::size_t(tx + i) * width) + ty + first),
+                                    std::size_t(rows - first));
+                    }
+                }
+                for(int j = 0; j < rows; j++){
+                    Cell* row = cells + (std::size_t(ty + j) * width) + tx;
+                    for(int i = 0; i < std::min(columns, ty + j - tx); i++){
+                        row[i] = tile[(i * side) + j];
+                    }
+                }
+            }
+        }
+    };
+
+    //passes that read what an earlier pass wrote run after it has finished
+    switch(symmetry){
+        case Symmetry::C1:
+            break;
+        case Symmetry::C2:
+            run_in_bands(threads, height, turn_half);
+            break;
+        case Symmetry::C4:
+            run_in_bands(threads, height, turn_quarter);
+            break;
+        case Symmetry::D2:
+            run_in_bands(threads, height, mirror_rows);
+            break;
+        case Symmetry::D4:
+            run_in_bands(threads, height, mirror_rows);
+            run_in_bands(threads, height, mirror_columns);
+            break;
+        case Symmetry::D8:
+            run_in_bands(threads, height, mirror_diagonal);
+            run_in_bands(threads, height, mirror_rows);
+            run_in_bands(threads, height, mirror_columns);
+            break;
+    }
+}
+
+/**
+ * Soup::make_soup(seed, index, size, symmetry)
+ *
+ * Make one random soup of a search, filled by Soup::fill at a density of one half on a single thread.
+ * The same seed and index always give the same soup.
+ *
+ * @example
+ *
+ *      // Make soup 42 of the search with seed 7
+ *      Grid soup = Soup::make_soup(7, 42, 16);
+ *
+ * @param seed
+ *      The seed of the search.
+ *
+ * @param index
+ *      The index of the soup within the search.
+ *
+ * @param size
+ *      The width and height of the soup.
+ *
+ * @param symmetry
+ *      Optional parameter. The symmetry to make the soup with, defaults to none.
+ *
+ * @return
+ *      A size x size grid with each cell alive with a chance of one half.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the symmetry needs a square grid and the grid is not square.
+ */
+Grid Soup::make_soup(std::uint64_t seed, long long index, int size, Symmetry symmetry){
+    Grid soup(size, size);
+    fill(soup, seed ^ mix(std::uint64_t(index)), 0.5, symmetry, 1);
+    return soup;
+}
+
+/**
+ * Soup::search(settings, table, progress)
+ *
+ * Run a soup search, censusing every soup that settles.
+ *
+ * @example
+ *
+ *      // Run 100000 soups on every core, printing how far it has got
+ *      Soup::Settings settings;
+ *      settings.soups = 100000;
+ *      Soup::Report report = Soup::search(settings, Census::Table(), [](long long soups, double seconds){
+ *          std::cout << soups << " soups, " << (soups / seconds) << " soups/s" << std::endl;
+ *      });
+ *
+ * @param settings
+ *      The size, number, rule and seed of the soups, see Soup::Settings.
+ *
+ * @param table
+ *      The table to name the objects found with.
+ *
+ * @param progress
+ *      Optional parameter. Called from the calling thread about once a second, and once at the end, with the number
+ *      of soups done and the seconds since the search started.
+ *
+ * @return
+ *      The counts of every object found, with the soups the rare ones came from.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the soup size is not positive, the world is smaller than the soups,
+ *      or the rule has more than two states.
+ */
+Soup::Report Soup::search(const Settings& settings, const Census::Table& table,
+                          std::function<void(long long soups, double seconds)> progress){
+    //exception
+    if(settings.size < 1 || settings.world < settings.size){
+        throw std::runtime_error("soup size must be positive and no larger than the world");
+    }
+    //exception
+    if(settings.rule.get_states() != 2){
+        throw std::runtime_error("rule has more than two states");
+    }
+    int threads = Parallel::get_threads(settings.threads);
+    std::size_t kept = std::size_t(std::max(settings.rare, 0)) + 1;
+    auto start = std::chrono::steady_clock::now();
+
+    //tallies what one soup settled into, or that it did not settle
+    auto count = [&](Tally& tally, long long index, bool settled, const Grid& state){
+        if(!settled){
+            tally.unstable.add(true, index);
+            return;
+        }
+        for(Census::Object& object : Census::take(roll(state), table)){
+            auto added = tally.finds.add(object.name, index, object.count);
+            if(added.second){
+                added.first.sample = object;
+            }
+        }
+    };
+
+    //runs every soup a thread takes, 64 at a time so totalistic rules can run them as one block of a SoupBatch
+    int offset = (settings.world - settings.size) / 2;
+    auto worker = [&](Tally& tally, long long first, long long last){
+        if(settings.rule.is_totalistic()){
+            SoupBatch batch(settings.world, settings.world, int(last - first), settings.rule);
+            std::vector<std::uint64_t> cells(std::size_t(settings.world) * settings.world, 0);
+            for(long long index = first; index < last; index++){
+                Grid soup = make_soup(settings.seed, index, settings.size, settings.symmetry);
+                for(int y = 0; y < settings.size; y++){
+                    for(int x = 0; x < settings.size; x++){
+                        if(soup(x, y) == Cell::ALIVE){
+                            cells[std::size_t(y + offset) * settings.world + x + offset] |= 1ULL << (index - first);
+                        }
+                    }
+                }
+            }
+            batch.set_block(0, cells);
+            batch.advance_until_settled(settings.generations, true);
+            std::uint64_t settled = batch.get_settled_mask(0);
+            for(long long index = first; index < last; index++){
+                int lane = int(index - first);
+                count(tally, index, (settled >> lane) & 1, batch.get_world(lane));
+            }
+        }
+        else{
+            for(long long index = first; index < last; index++){
+                Grid grid(settings.world, settings.world);
+                grid.merge(make_soup(settings.seed, index, settings.size, settings.symmetry), offset, offset);
+                World world(grid);
+                world.set_rule(settings.rule);
+                Stability stability = world.advance_until_stable(settings.generations, Topology::TORUS,
+                                                                 4 * settings.world);
+                count(tally, index, stability.period != 0, world.get_state());
+            }
+        }
+    };
+    auto seconds = [&](){
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+    Tally empty = {Parallel::Finds<std::string, Census::Object>(kept), Parallel::Finds<bool, bool>(kept)};
+    std::vector<Tally> tallies = Parallel::run_chunks(threads, settings.soups, 64, empty, worker,
+                                                      [&](long long done){
+        if(progress){
+            progress(done, seconds());
+        }
+    });
+
+    //merge the tallies, keeping the earliest soups of each object so the report does not depend on the threads
+    Report report = {std::max(settings.soups, 0LL), 0, seconds(), {}, {}};
+    for(std::size_t t = 1; t < tallies.size(); t++){
+        tallies[0].finds.merge(tallies[t].finds);
+        tallies[0].unstable.merge(tallies[t].unstable);
+    }
+    for(const auto& merged : tallies[0].finds.list()){
+        Find find = {merged.sample, merged.indices};
+        find.object.count = merged.count;
+        report.finds.push_back(find);
+    }
+    for(const auto& merged : tallies[0].unstable.list()){
+        report.unstable = merged.count;
+        report.unstableSoups = merged.indices;
+    }
+
+    //most common first, then by name
+    std::sort(report.finds.begin(), report.finds.end(), [](const Find& a, const Find& b){
+        if(a.object.count != b.object.count){
+            return a.object.count > b.object.count;
+        }
+        return a.object.name < b.object.name;
+    });
+    if(progress){
+        progress(report.soups, report.seconds);
+    }
+    return report;
+}
+
+/**
+ * Soup::save_report(path, settings, report)
+ *
+ * Save the results of a soup search as a text file.
+ *      - A header of lines starting with '#' describes the search.
+ *      - Then each object is listed on its own line as its count and name, most common first.
+ *      - Then each rare object, found in no more than settings.rare soups, is drawn with the soups it was found in.
+ *      - Then the soups that did not settle are listed.
+ * Should be implemented using std::ofstream.
+ *
+ * @example
+ *
+ *      // Save the results of a search
+ *      Soup::save_report("path/to/census.txt", settings, Soup::search(settings, Census::Table()));
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param settings
+ *      The settings the search was run with.
+ *
+ * @param report
+ *      The results of the search.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened.
+ */
+void Soup::save_report(std::string path, const Settings& settings, const Report& report){
+    std::ofstream outputFile(path);
+    //exception
+    if(!outputFile.is_open()){
+        throw std::runtime_error("can't be opened");
+    }
+
+    const char* symmetries[] = {"C1", "C2", "C4", "D2", "D4", "D8"};
+    outputFile << "# Soup search of " << report.soups << " soups in " << settings.rule.get_name()
+               << " from seed " << settings.seed << "\n"
+               << "# " << settings.size << "x" << settings.size << " " << symmetries[int(settings.symmetry)]
+               << " soups on a " << settings.world << "x"
+               << settings.world << " torus, run for at most " << settings.generations << " generations\n"
+               << "# " << report.seconds << " seconds, " << (report.seconds > 0 ? report.soups / report.seconds : 0)
+               << " soups per second\n"
+               << "# " << report.unstable << " soups did not settle\n";
+    for(const Find& find : report.finds){
+        outputFile << find.object.count << " " << find.object.name << "\n";
+    }
+
+    //draw the rare objects with where to find them
+    outputFile << "\n# Rare objects, found in no more than " << settings.rare << " soups\n";
+    for(const Find& find : report.finds){
+        if(int(find.soups.size()) > settings.rare){
+            continue;
+        }
+        outputFile << find.object.name << " found in soups";
+        for(long long soup : find.soups){
+            outputFile << " " << soup;
+        }
+        outputFile << "\n" << find.object.pattern;
+    }
+
+    outputFile << "\n# Soups that did not settle\n";
+    for(long long soup : report.unstableSoups){
+        outputFile << soup << "\n";
+    }
+    outputFile.close();
+}
@@ -0,0 +1,90 @@
+/**
+ * Declares a Soup namespace with methods for running random soup searches.
+ * Rich documentation for the api and behaviour the Soup namespace can be found in soup.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the namespace.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+#include "census.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Declare the interface of the Soup namespace for generating random soups and censusing what they leave behind.
+ */
+namespace Soup {
+
+    /**
+     * The symmetries a random fill can be made with.
+     *      - C1 has no symmetry.
+     *      - C2 looks the same turned half way round, and C4 turned a quarter of the way round.
+     *      - D2 is mirrored left to right, D4 is mirrored left to right and top to bottom, and D8 is mirrored along
+     *        both diagonals as well.
+     *      - C4 and D8 need a square grid.
+     */
+    enum class Symmetry {
+        C1,
+        C2,
+        C4,
+        D2,
+        D4,
+        D8
+    };
+
+    /**
+     * Settings for a soup search.
+     *      - seed and the index of each soup decide its cells, so any soup can be made again from the two.
+     *      - size is the width and height of each soup, placed in the middle of a world x world torus.
+     *      - generations is the most steps a soup is run for before it is given up on as unstable.
+     *      - threads is the number of threads to search with, or 0 for one per core.
+     *      - rare is the number of soups an object can be found in at most to be reported as rare.
+     *      - symmetry is the symmetry each soup is made with.
+     */
+    struct Settings {
+        std::uint64_t seed = 1;
+        long long soups = 1000;
+        int size = 16;
+        int world = 64;
+        int generations = 4000;
+        int threads = 0;
+        int rare = 5;
+        Symmetry symmetry = Symmetry::C1;
+        Rule rule;
+    };
+
+    /**
+     * A Find is one kind of object found by a search, with the first few soups it was found in, in order.
+     */
+    struct Find {
+        Census::Object object;
+        std::vector<long long> soups;
+    };
+
+    /**
+     * A Report sums up a soup search.
+     *      - finds are every kind of object found, most common first.
+     *      - unstableSoups are the first few soups that did not settle within the generation limit.
+     */
+    struct Report {
+        long long soups;
+        long long unstable;
+        double seconds;
+        std::vector<Find> finds;
+        std::vector<long long> unstableSoups;
+    };
+
+    void fill(Grid& grid, std::uint64_t seed, double density = 0.5, Symmetry symmetry = Symmetry::C1, int threads = 0);
+    Grid make_soup(std::uint64_t seed, long long index, int size, Symmetry symmetry = Symmetry::C1);
+    Report search(const Settings& settings, const Census::Table& table,
+                  std::function<void(long long soups, double seconds)> progress = nullptr);
+    void save_report(std::string path, const Settings& settings, const Report& report);
+
+};
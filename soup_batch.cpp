@@ -0,0 +1,681 @@
+/**
+ * Implements a class representing a batch of small independent worlds simulated together, one per bit of a word.
+ *      - A SoupBatch holds any number of equally sized worlds, such as the 16x16 soups of a soup search.
+ *      - The worlds are bit-sliced, each cell of the batch is a 64 bit word where bit k is that cell in world k
+ *        of the block, so one bitwise kernel steps 64 worlds at a time.
+ *          - The 8 neighbours of a cell are summed with a tree of bitwise adders into 4 bit planes of the
+ *            count, which the rule is then applied to with bitwise logic.
+ *          - The kernel has no branches, so the compiler is free to vectorise it across several words.
+ *          - Each block is padded with a halo of cells, dead for a plane or wrapped for a torus.
+ *
+ *      - Batches can be filled a world at a time from a Grid, or a block at a time from words.
+ *      - Batches report the population of each world, and masks of the worlds in a block that are alive,
+ *        that changed in the last step, and that have settled.
+ *          - A world has settled once it repeats an earlier generation, and stepping it further only repeats.
+ *          - Still lifes, period 2 oscillators and empty worlds are caught straight away by comparing against
+ *            the two generations before.
+ *          - Longer cycles, such as a glider going round a torus, are caught by comparing against a snapshot
+ *            retaken whenever the generation reaches a power of two, as in Brent's cycle detection. Any cycle
+ *            is caught within about twice the generation it started on plus its period.
+ *          - Blocks where no world changed in the last step are skipped.
+ *
+ *      - Only two state totalistic rules are supported, as in B/S notation.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "soup_batch.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * SoupBatch::SoupBatch(width, height, size, rule)
+ *
+ * Construct a batch of empty worlds of the same size.
+ *
+ * @example
+ *
+ *      // Make a batch of 10000 16x16 worlds
+ *      SoupBatch batch(16, 16, 10000);
+ *
+ * @param width
+ *      The width of every world.
+ *
+ * @param height
+ *      The height of every world.
+ *
+ * @param size
+ *      The number of worlds.
+ *
+ * @param rule
+ *      Optional parameter. The rule to simulate with. Defaults to B3/S23.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The width or height is not a positive integer, or the size is negative.
+ *          - The rule is not a two state totalistic rule.
+ */
+SoupBatch::SoupBatch(int width, int height, int size, Rule rule){
+    //exception
+    if(width < 1 || height < 1 || size < 0){
+        throw std::runtime_error("width and height must be positive and size not negative");
+    }
+    //exception
+    if(rule.get_states() != 2 || !rule.is_totalistic()){
+        throw std::runtime_error("rule must be a two state totalistic rule");
+    }
+    this->width = width;
+    this->height = height;
+    this->size = size;
+    this->rule = rule;
+    this->generation = 0;
+
+    int blocks = get_blocks();
+    std::size_t cells = std::size_t(width + 2) * (height + 2);
+    currentCells.assign(blocks, std::vector<std::uint64_t>(cells, 0));
+    previousCells.assign(blocks, std::vector<std::uint64_t>(cells, 0));
+    olderCells.assign(blocks, std::vector<std::uint64_t>(cells, 0));
+    snapshotCells.assign(blocks, std::vector<std::uint64_t>(cells, 0));
+    aliveMasks.assign(blocks, 0);
+    changedMasks.assign(blocks, 0);
+    settledMasks.assign(blocks, 0);
+
+    //nothing is known about the worlds until they are first stepped
+    for(int block = 0; block < blocks; block++){
+        changedMasks[block] = get_lane_mask(block);
+    }
+}
+
+/**
+ * SoupBatch::get_width()
+ *
+ * Gets the width of every world in the batch.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The width of the worlds.
+ */
+int SoupBatch::get_width() const{
+    return this->width;
+}
+
+/**
+ * SoupBatch::get_height()
+ *
+ * Gets the height of every world in the batch.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The height of the worlds.
+ */
+int SoupBatch::get_height() const{
+    return this->height;
+}
+
+/**
+ * SoupBatch::get_size()
+ *
+ * Gets the number of worlds in the batch.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of worlds.
+ */
+int SoupBatch::get_size() const{
+    return this->size;
+}
+
+/**
+ * SoupBatch::get_blocks()
+ *
+ * Gets the number of blocks of 64 worlds, world k is bit (k % 64) of block (k / 64).
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of blocks.
+ */
+int SoupBatch::get_blocks() const{
+    return (size + 63) / 64;
+}
+
+/**
+ * SoupBatch::get_generation()
+ *
+ * Gets the number of steps the batch has taken since it was constructed.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The current generation number.
+ */
+int SoupBatch::get_generation() const{
+    return generation;
+}
+
+/**
+ * SoupBatch::get_rule()
+ *
+ * Gets the rule the batch is simulated with.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A read-only reference to the rule.
+ */
+const Rule& SoupBatch::get_rule() const{
+    return rule;
+}
+
+/**
+ * SoupBatch::get_index(x, y)
+ *
+ * Private helper function to determine the index of a cell in the padded words of a block.
+ * The function should be callable from a constant context.
+ *
+ * @param x
+ *      The x coordinate of the cell, from -1 to the width.
+ *
+ * @param y
+ *      The y coordinate of the cell, from -1 to the height.
+ *
+ * @return
+ *      The offset of the cell from the start of the block.
+ */
+int SoupBatch::get_index(int x, int y) const{
+    return (x + 1) + ((width + 2) * (y + 1));
+}
+
+/**
+ * SoupBatch::get_lane_mask(block)
+ *
+ * Private helper function to get a mask of the bits of a block that belong to a world, as the last block
+ * may be part full.
+ * The function should be callable from a constant context.
+ *
+ * @param block
+ *      The block to get the mask of.
+ *
+ * @return
+ *      The mask of the worlds in the block.
+ */
+std::uint64_t SoupBatch::get_lane_mask(int block) const{
+    int lanes = std::min(size - (block * 64), 64);
+    return (lanes == 64) ? ~std::uint64_t(0) : ((std::uint64_t(1) << lanes) - 1);
+}
+
+/**
+ * SoupBatch::set_world(world, grid)
+ *
+ * Overwrite one world with the cells of a grid, placed at its top left corner with the rest of the world dead.
+ *
+ * @example
+ *
+ *      // Put a glider in world 70
+ *      SoupBatch batch(16, 16, 100);
+ *      batch.set_world(70, Zoo::glider());
+ *
+ * @param world
+ *      The index of the world to overwrite.
+ *
+ * @param grid
+ *      The cells to write, no larger than the worlds.
+ *
+ * @throws
+ *      std::exception or sub-class if the world is not in the batch or the grid is larger than the worlds.
+ */
+void SoupBatch::set_world(int world, const Grid& grid){
+    //exception
+    if(world < 0 || world >= size){
+        throw std::runtime_error("not within bounds");
+    }
+    //exception
+    if(grid.get_width() > width || grid.get_height() > height){
+        throw std::runtime_error("grid larger than the worlds");
+    }
+    int block = world / 64;
+    std::uint64_t bit = std::uint64_t(1) << (world % 64);
+
+    //nested loops that write the world's bit of every cell, clearing its history too
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            int index = get_index(x, y);
+            bool alive = x < grid.get_width() && y < grid.get_height() && grid(x, y) == Cell::ALIVE;
+            currentCells[block][index] = alive ? (currentCells[block][index] | bit) : (currentCells[block][index] & ~bit);
+            previousCells[block][index] &= ~bit;
+            olderCells[block][index] &= ~bit;
+            snapshotCells[block][index] &= ~bit;
+        }
+    }
+    aliveMasks[block] = grid.get_alive_cells() ? (aliveMasks[block] | bit) : (aliveMasks[block] & ~bit);
+    changedMasks[block] |= bit;
+    settledMasks[block] &= ~bit;
+}
+
+/**
+ * SoupBatch::set_block(block, cells)
+ *
+ * Overwrite a block of 64 worlds at once from words in the same bit-sliced layout the batch uses, which is the
+ * fastest way to fill a batch with random soups. Bits for worlds past the end of the batch are ignored.
+ *
+ * @example
+ *
+ *      // Fill block 0 with 64 random 16x16 soups at density one half
+ *      std::mt19937_64 random(1);
+ *      std::vector<std::uint64_t> cells(16 * 16);
+ *      for(std::uint64_t& word : cells){
+ *          word = random();
+ *      }
+ *      batch.set_block(0, cells);
+ *
+ * @param block
+ *      The index of the block to overwrite.
+ *
+ * @param cells
+ *      Width * height words in row order, where bit k of each word is the cell in world (64 * block + k).
+ *
+ * @throws
+ *      std::exception or sub-class if the block is not in the batch or there are not width * height words.
+ */
+void SoupBatch::set_block(int block, const std::vector<std::uint64_t>& cells){
+    //exception
+    if(block < 0 || block >= get_blocks() || int(cells.size()) != width * height){
+        throw std::runtime_error("block not within bounds or wrong number of cells");
+    }
+    std::uint64_t lanes = get_lane_mask(block);
+    std::uint64_t alive = 0;
+
+    //nested loops that copy each row in, clearing the history of the block
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            std::uint64_t word = cells[(y * width) + x] & lanes;
+            currentCells[block][get_index(x, y)] = word;
+            previousCells[block][get_index(x, y)] = 0;
+            olderCells[block][get_index(x, y)] = 0;
+            snapshotCells[block][get_index(x, y)] = 0;
+            alive |= word;
+        }
+    }
+    aliveMasks[block] = alive;
+    changedMasks[block] = lanes;
+    settledMasks[block] = 0;
+}
+
+/**
+ * SoupBatch::get_world(world)
+ *
+ * Copy the current state of one world out to a Grid.
+ * The function should be callable from a constant context.
+ *
+ * @param world
+ *      The index of the world to copy.
+ *
+ * @return
+ *      A width x height grid of the world's cells.
+ *
+ * @throws
+ *      std::exception or sub-class if the world is not in the batch.
+ */
+Grid SoupBatch::get_world(int world) const{
+    //exception
+    if(world < 0 || world >= size){
+        throw std::runtime_error("not within bounds");
+    }
+    Grid grid(width, height);
+    const std::vector<std::uint64_t>& cells = currentCells[world / 64];
+
+    //nested loops that read the world's bit of every cell
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            if((cells[get_index(x, y)] >> (world % 64)) & 1){
+                grid(x, y) = Cell::ALIVE;
+            }
+        }
+    }
+    return grid;
+}
+
+/**
+ * SoupBatch::get_population(world)
+ *
+ * Counts the alive cells in one world.
+ * The function should be callable from a constant context.
+ *
+ * @param world
+ *      The index of the world to count.
+ *
+ * @return
+ *      The number of alive cells in the world.
+ *
+ * @throws
+ *      std::exception or sub-class if the world is not in the batch.
+ */
+int SoupBatch::get_population(int world) const{
+    //exception
+    if(world < 0 || world >= size){
+        throw std::runtime_error("not within bounds");
+    }
+    const std::vector<std::uint64_t>& cells = currentCells[world / 64];
+    int count = 0;
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            count += int((cells[get_index(x, y)] >> (world % 64)) & 1);
+        }
+    }
+    return count;
+}
+
+/**
+ * SoupBatch::get_populations()
+ *
+ * Counts the alive cells in every world.
+ * The function should be callable from a constant context.
+ *
+ * Each block is counted with a bit-sliced counter, bit plane i holding bit i of all 64 counts, so adding a
+ * word of cells takes a couple of bitwise operations on average rather than one per world.
+ *
+ * @return
+ *      The number of alive cells in each world, in order.
+ */
+std::vector<int> SoupBatch::get_populations() const{
+    std::vector<int> populations(size, 0);
+
+    //loop that counts every block
+    for(int block = 0; block < get_blocks(); block++){
+        std::uint64_t planes[32] = {0};
+        const std::vector<std::uint64_t>& cells = currentCells[block];
+        for(int y = 0; y < height; y++){
+            for(int x = 0; x < width; x++){
+                //ripple the carry up the planes
+                std::uint64_t carry = cells[get_index(x, y)];
+                for(int plane = 0; carry; plane++){
+                    std::uint64_t overflow = planes[plane] & carry;
+                    planes[plane] ^= carry;
+                    carry = overflow;
+                }
+            }
+        }
+        for(int lane = 0; lane < 64 && (block * 64) + lane < size; lane++){
+            int count = 0;
+            for(int plane = 0; plane < 32; plane++){
+                count |= int((planes[plane] >> lane) & 1) << plane;
+            }
+            populations[(block * 64) + lane] = count;
+        }
+    }
+    return populations;
+}
+
+/**
+ * SoupBatch::get_alive_mask(block)
+ *
+ * Gets a mask of the worlds in a block that have any alive cells, bit k for world (64 * block + k).
+ * The function should be callable from a constant context.
+ *
+ * @param block
+ *      The index of the block.
+ *
+ * @return
+ *      The mask of the worlds that are not empty.
+ */
+std::uint64_t SoupBatch::get_alive_mask(int block) const{
+    return aliveMasks.at(block);
+}
+
+/**
+ * SoupBatch::get_changed_mask(block)
+ *
+ * Gets a mask of the worlds in a block that changed in the last step, or were set since then.
+ * The function should be callable from a constant context.
+ *
+ * @param block
+ *      The index of the block.
+ *
+ * @return
+ *      The mask of the worlds that changed.
+ */
+std::uint64_t SoupBatch::get_changed_mask(int block) const{
+    return changedMasks.at(block);
+}
+
+/**
+ * SoupBatch::get_settled_mask(block)
+ *
+ * Gets a mask of the worlds in a block that have repeated an earlier generation since they were set,
+ * so they will only repeat from now on. Empty worlds, still lifes and period 2 oscillators are found
+ * as soon as they repeat, longer cycles within about twice the generation they started on plus their period.
+ * The function should be callable from a constant context.
+ *
+ * @param block
+ *      The index of the block.
+ *
+ * @return
+ *      The mask of the worlds that have settled.
+ */
+std::uint64_t SoupBatch::get_settled_mask(int block) const{
+    return settledMasks.at(block);
+}
+
+/**
+ * SoupBatch::is_settled()
+ *
+ * Checks if every world in the batch has settled, see SoupBatch::get_settled_mask(block).
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      Returns true if every world has settled.
+ */
+bool SoupBatch::is_settled() const{
+    for(int block = 0; block < get_blocks(); block++){
+        if(settledMasks[block] != get_lane_mask(block)){
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * SoupBatch::fill_halo(cells, toroidal)
+ *
+ * Private helper function to fill the ring of padding around a block, with dead cells for a plane
+ * or with the cells from the opposite edges for a torus.
+ *
+ * @param cells
+ *      The padded words of the block.
+ *
+ * @param toroidal
+ *      If true then the halo wraps around as a torus.
+ */
+void SoupBatch::fill_halo(std::vector<std::uint64_t>& cells, bool toroidal){
+    //the left and right columns first, then whole rows so the corners come from the columns
+    for(int y = 0; y < height; y++){
+        cells[get_index(-1, y)] = toroidal ? cells[get_index(width - 1, y)] : 0;
+        cells[get_index(width, y)] = toroidal ? cells[get_index(0, y)] : 0;
+    }
+    for(int x = -1; x <= width; x++){
+        cells[get_index(x, -1)] = toroidal ? cells[get_index(x, height - 1)] : 0;
+        cells[get_index(x, height)] = toroidal ? cells[get_index(x, 0)] : 0;
+    }
+}
+
+/**
+ * SoupBatch::step_block<Standard>(block)
+ *
+ * Private helper function to step all 64 worlds of a block, writing into the older state and rotating the
+ * states so it becomes the current one. The masks of the block are updated as the cells are written, a world
+ * that matches the generation before, the one before that, or the snapshot has settled.
+ *
+ * When Standard = true the rule of Conway's Game of Life is written directly into the bitwise logic.
+ * Otherwise the rule is expanded into a table of words before the loop, and the entry for each bit is picked
+ * out using the count bit planes.
+ *
+ * @param block
+ *      The index of the block to step.
+ */
+template <bool Standard>
+void SoupBatch::step_block(int block){
+    const std::vector<std::uint64_t>& current = currentCells[block];
+    const std::vector<std::uint64_t>& previous = previousCells[block];
+    const std::vector<std::uint64_t>& snapshot = snapshotCells[block];
+    std::vector<std::uint64_t>& next = olderCells[block];
+
+    //the rule as a word of all ones or all zeros for each state (dead then alive) and neighbour count
+    std::uint64_t table[2][9];
+    for(int n = 0; n <= 8; n++){
+        table[0][n] = (rule.get_transition(Cell::DEAD, n) == Cell::ALIVE) ? ~std::uint64_t(0) : 0;
+        table[1][n] = (rule.get_transition(Cell::ALIVE, n) == Cell::ALIVE) ? ~std::uint64_t(0) : 0;
+    }
+
+    //picks the entry of a row of the table for each bit using the count bit planes, as a tree of selects
+    auto select = [](const std::uint64_t* row, std::uint64_t bit0, std::uint64_t bit1, std::uint64_t bit2, std::uint64_t bit3){
+        std::uint64_t pick01 = (row[1] & bit0) | (row[0] & ~bit0);
+        std::uint64_t pick23 = (row[3] & bit0) | (row[2] & ~bit0);
+        std::uint64_t pick45 = (row[5] & bit0) | (row[4] & ~bit0);
+        std::uint64_t pick67 = (row[7] & bit0) | (row[6] & ~bit0);
+        std::uint64_t pick03 = (pick23 & bit1) | (pick01 & ~bit1);
+        std::uint64_t pick47 = (pick67 & bit1) | (pick45 & ~bit1);
+        std::uint64_t pick07 = (pick47 & bit2) | (pick03 & ~bit2);
+        return (row[8] & bit3) | (pick07 & ~bit3);
+    };
+
+    std::uint64_t alive = 0;
+    std::uint64_t changed = 0;
+    std::uint64_t repeated = 0;
+    std::uint64_t looped = 0;
+
+    //nested loop that steps each cell of all 64 worlds at once
+    for(int y = 0; y < height; y++){
+        const std::uint64_t* above = &current[get_index(0, y - 1)];
+        const std::uint64_t* centre = &current[get_index(0, y)];
+        const std::uint64_t* below = &current[get_index(0, y + 1)];
+        const std::uint64_t* before = &previous[get_index(0, y)];
+        const std::uint64_t* earlier = &snapshot[get_index(0, y)];
+        std::uint64_t* out = &next[get_index(0, y)];
+
+        for(int x = 0; x < width; x++){
+            //three full adders and a half adder give the ones and twos of each group of neighbours
+            std::uint64_t a = above[x - 1] ^ above[x] ^ above[x + 1];
+            std::uint64_t aCarry = (above[x - 1] & above[x]) | (above[x + 1] & (above[x - 1] ^ above[x]));
+            std::uint64_t b = centre[x - 1] ^ centre[x + 1];
+            std::uint64_t bCarry = centre[x - 1] & centre[x + 1];
+            std::uint64_t c = below[x - 1] ^ below[x] ^ below[x + 1];
+            std::uint64_t cCarry = (below[x - 1] & below[x]) | (below[x + 1] & (below[x - 1] ^ below[x]));
+
+            //then sum the ones into bit 0, and the twos and carried twos into bits 1, 2 and 3
+            std::uint64_t bit0 = a ^ b ^ c;
+            std::uint64_t twos = (a & b) | (c & (a ^ b));
+            std::uint64_t sum = aCarry ^ bCarry ^ cCarry;
+            std::uint64_t fours = (aCarry & bCarry) | (cCarry & (aCarry ^ bCarry));
+            std::uint64_t bit1 = sum ^ twos;
+            std::uint64_t moreFours = sum & twos;
+            std::uint64_t bit2 = fours ^ moreFours;
+            std::uint64_t bit3 = fours & moreFours;
+
+            std::uint64_t cell = centre[x];
+            std::uint64_t result;
+            if(Standard){
+                //2 or 3 neighbours is the only way to have bit 1 set without bits 2 or 3
+                result = bit1 & ~bit2 & ~bit3 & (bit0 | cell);
+            }else{
+                result = (select(table[1], bit0, bit1, bit2, bit3) & cell) |
+                         (select(table[0], bit0, bit1, bit2, bit3) & ~cell);
+            }
+            out[x] = result;
+            alive |= result;
+            changed |= result ^ cell;
+            repeated |= result ^ before[x];
+            looped |= result ^ earlier[x];
+        }
+    }
+
+    //rotate the states so the new one is current
+    std::uint64_t lanes = get_lane_mask(block);
+    aliveMasks[block] = alive & lanes;
+    changedMasks[block] = changed & lanes;
+    settledMasks[block] |= (~changed | ~repeated | ~looped) & lanes;
+    std::swap(previousCells[block], olderCells[block]);
+    std::swap(currentCells[block], previousCells[block]);
+}
+
+/**
+ * SoupBatch::step(toroidal)
+ *
+ * Take one step in every world of the batch.
+ * Should be implemented by invoking SoupBatch::step_block<Standard>(block) for every block where a world changed,
+ * a block where none changed is the same in the next generation so it is left as it is.
+ * Every block's snapshot is retaken when the generation reaches a power of two.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then every world is considered as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom. Defaults to false.
+ */
+void SoupBatch::step(bool toroidal){
+    //loop that steps each block that can still change
+    for(int block = 0; block < get_blocks(); block++){
+        if(!changedMasks[block]){
+            continue;
+        }
+        fill_halo(currentCells[block], toroidal);
+        if(rule.is_standard()){
+            step_block<true>(block);
+        }else{
+            step_block<false>(block);
+        }
+    }
+    generation++;
+
+    //retake the snapshots at each power of two
+    if((generation & (generation - 1)) == 0){
+        for(int block = 0; block < get_blocks(); block++){
+            snapshotCells[block] = currentCells[block];
+        }
+    }
+}
+
+/**
+ * SoupBatch::advance(steps, toroidal)
+ *
+ * Advance multiple steps in every world of the batch.
+ * Should be implemented by invoking SoupBatch::step(toroidal).
+ *
+ * @param steps
+ *      The number of steps to advance the batch forward.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then every world is considered as a torus. Defaults to false.
+ */
+void SoupBatch::advance(int steps, bool toroidal){
+    //change batch the number of steps
+    for(int i = 0; i < steps; i++){
+        step(toroidal);
+    }
+}
+
+/**
+ * SoupBatch::advance_until_settled(steps, toroidal)
+ *
+ * Advance up to a number of steps in every world of the batch, stopping early once every world has settled.
+ * Should be implemented by invoking SoupBatch::step(toroidal).
+ *
+ * @example
+ *
+ *      // Run a batch of soups until they settle, or for 1000 generations at most
+ *      int steps = batch.advance_until_settled(1000);
+ *
+ * @param steps
+ *      The largest number of steps to advance the batch forward.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then every world is considered as a torus. Defaults to false.
+ *
+ * @return
+ *      The number of steps that were actually taken.
+ */
+int SoupBatch::advance_until_settled(int steps, bool toroidal){
+    int taken = 0;
+    while(taken < steps && !is_settled()){
+        step(toroidal);
+        taken++;
+    }
+    return taken;
+}
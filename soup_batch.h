@@ -0,0 +1,68 @@
+/**
+ * Declares a class representing a batch of small independent worlds simulated together, one per bit of a word.
+ * Rich documentation for the api and behaviour the SoupBatch class can be found in soup_batch.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include "rule.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * Declare the structure of the SoupBatch class for stepping many equally sized worlds at once.
+ *
+ * The worlds are split into blocks of 64. Each block holds three padded grids of 64 bit words for the current,
+ * previous and older states, rotated using std::swap after each update step, and a snapshot of an earlier state.
+ */
+class SoupBatch {
+    private:
+        int width;
+        int height;
+        int size;
+        Rule rule;
+        int generation;
+        std::vector<std::vector<std::uint64_t>> currentCells;
+        std::vector<std::vector<std::uint64_t>> previousCells;
+        std::vector<std::vector<std::uint64_t>> olderCells;
+        std::vector<std::vector<std::uint64_t>> snapshotCells;
+        std::vector<std::uint64_t> aliveMasks;
+        std::vector<std::uint64_t> changedMasks;
+        std::vector<std::uint64_t> settledMasks;
+
+        int get_index(int x, int y) const;
+        std::uint64_t get_lane_mask(int block) const;
+        void fill_halo(std::vector<std::uint64_t>& cells, bool toroidal);
+        template <bool Standard>
+        void step_block(int block);
+
+    public:
+        SoupBatch(int width, int height, int size, Rule rule = Rule());
+
+        int get_width() const;
+        int get_height() const;
+        int get_size() const;
+        int get_blocks() const;
+        int get_generation() const;
+        const Rule& get_rule() const;
+
+        void set_world(int world, const Grid& grid);
+        void set_block(int block, const std::vector<std::uint64_t>& cells);
+        Grid get_world(int world) const;
+
+        int get_population(int world) const;
+        std::vector<int> get_populations() const;
+        std::uint64_t get_alive_mask(int block) const;
+        std::uint64_t get_changed_mask(int block) const;
+        std::uint64_t get_settled_mask(int block) const;
+        bool is_settled() const;
+
+        void step(bool toroidal = false);
+        void advance(int steps, bool toroidal = false);
+        int advance_until_settled(int steps, bool toroidal = false);
+};
@@ -0,0 +1,408 @@
+/**
+ * Implements a class representing a 2d grid of multi-state cells, packed two cells to a byte.
+ *      - Cells hold a state from 0 to 15, where 0 is dead, 1 is alive and 2 and up are dying in Generations rules.
+ *      - Each cell takes half a byte, the cell at an even index is in the low 4 bits of its byte
+ *        and the cell at the following odd index is in the high 4 bits.
+ *      - New cells are initialized to state 0.
+ *      - Rows can be unpacked to one byte per cell for processing and packed back again.
+ *      - StateGrids can be made from a Grid and turned back into one, keeping only the alive cells.
+ *      - StateGrids can be serialized directly to an ascii std::ostream.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "state_grid.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <stdexcept>
+
+/**
+ * StateGrid::StateGrid()
+ *
+ * Construct an empty grid of size 0x0.
+ *
+ * @example
+ *
+ *      // Make a 0x0 empty grid
+ *      StateGrid grid;
+ *
+ */
+StateGrid::StateGrid(){
+    this->width = 0;
+    this->height = 0;
+}
+
+/**
+ * StateGrid::StateGrid(square_size)
+ *
+ * Construct a square grid with the desired size filled with dead cells.
+ *
+ * @example
+ *
+ *      // Make a 16x16 grid
+ *      StateGrid grid(16);
+ *
+ * @param square_size
+ *      The edge size to use for the width and height of the grid.
+ */
+StateGrid::StateGrid(int square_size) : StateGrid(square_size, square_size){
+}
+
+/**
+ * StateGrid::StateGrid(width, height)
+ *
+ * Construct a grid with the desired size filled with dead cells.
+ *
+ * @example
+ *
+ *      // Make a 16x9 grid
+ *      StateGrid grid(16, 9);
+ *
+ * @param width
+ *      The width of the grid.
+ *
+ * @param height
+ *      The height of the grid.
+ */
+StateGrid::StateGrid(int width, int height){
+    this->width = width;
+    this->height = height;
+
+    //two cells share each byte, with a spare half byte at the end for an odd number of cells
+    gridCells.assign(((std::size_t(width) * height) + 1) / 2, 0);
+}
+
+/**
+ * StateGrid::StateGrid(grid)
+ *
+ * Construct a grid the same size as a two state Grid, with its alive cells in state 1.
+ *
+ * @example
+ *
+ *      // Start a Generations world from a glider
+ *      StateGrid grid(Zoo::glider());
+ *
+ * @param grid
+ *      The grid to copy the alive cells from.
+ */
+StateGrid::StateGrid(const Grid& grid) : StateGrid(grid.get_width(), grid.get_height()){
+    //nested loops that copy each alive cell across
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            if(grid(x, y) == Cell::ALIVE){
+                set(x, y, 1);
+            }
+        }
+    }
+}
+
+/**
+ * StateGrid::get_width()
+ *
+ * Gets the current width of the grid.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The width of the grid.
+ */
+int StateGrid::get_width() const{
+    return this->width;
+}
+
+/**
+ * StateGrid::get_height()
+ *
+ * Gets the current height of the grid.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The height of the grid.
+ */
+int StateGrid::get_height() const{
+    return this->height;
+}
+
+/**
+ * StateGrid::get_total_cells()
+ *
+ * Gets the total number of cells in the grid.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of total cells.
+ */
+int StateGrid::get_total_cells() const{
+    return (this->height * this->width);
+}
+
+/**
+ * StateGrid::get_alive_cells()
+ *
+ * Counts how many cells in the grid are alive (state 1). Dying cells are not counted.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of alive cells.
+ */
+int StateGrid::get_alive_cells() const{
+    int count = 0;
+
+    //loop checks grid for alive cells
+    for (int i = 0; i < get_total_cells(); i++) {
+        if(((gridCells[i / 2] >> ((i % 2) * 4)) & 0xF) == 1){
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * StateGrid::get_dead_cells()
+ *
+ * Counts how many cells in the grid are dead (state 0).
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of dead cells.
+ */
+int StateGrid::get_dead_cells() const{
+    int count = 0;
+
+    //loop checks grid for dead cells
+    for (int i = 0; i < get_total_cells(); i++) {
+        if(((gridCells[i / 2] >> ((i % 2) * 4)) & 0xF) == 0){
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * StateGrid::get_index(x, y)
+ *
+ * Private helper function to determine the 1d cell index of a 2d coordinate.
+ * The cell is stored in byte (index / 2).
+ * The function should be callable from a constant context.
+ *
+ * @param x
+ *      The x coordinate of the cell.
+ *
+ * @param y
+ *      The y coordinate of the cell.
+ *
+ * @return
+ *      The 1d offset of the cell from the start of the grid.
+ */
+int StateGrid::get_index(int x, int y) const{
+    //using the formula for converting 2d vector to 1d
+    return x + (width * y);
+}
+
+/**
+ * StateGrid::get(x, y)
+ *
+ * Returns the state of the cell at the desired coordinate.
+ * The function should be callable from a constant context.
+ *
+ * @example
+ *
+ *      // Make a grid
+ *      StateGrid grid(4, 4);
+ *
+ *      // Read the cell at coordinate (1, 2)
+ *      int state = grid.get(1, 2);
+ *
+ * @param x
+ *      The x coordinate of the cell to read.
+ *
+ * @param y
+ *      The y coordinate of the cell to read.
+ *
+ * @return
+ *      The state of the desired cell, from 0 to 15.
+ *
+ * @throws
+ *      std::exception or sub-class if x,y is not a valid coordinate within the grid.
+ */
+int StateGrid::get(int x, int y) const{
+    //exception
+    if(x >= get_width() || y >= get_height() || x<0 || y<0){
+        throw std::runtime_error("not within bounds");
+    }
+    int index = get_index(x, y);
+    return (gridCells[index / 2] >> ((index % 2) * 4)) & 0xF;
+}
+
+/**
+ * StateGrid::set(x, y, state)
+ *
+ * Overwrites the state of the cell at the desired coordinate.
+ *
+ * @example
+ *
+ *      // Make a grid
+ *      StateGrid grid(4, 4);
+ *
+ *      // Make the cell at coordinate (1, 2) alive
+ *      grid.set(1, 2, 1);
+ *
+ * @param x
+ *      The x coordinate of the cell to update.
+ *
+ * @param y
+ *      The y coordinate of the cell to update.
+ *
+ * @param state
+ *      The state to write, from 0 to 15.
+ *
+ * @throws
+ *      std::exception or sub-class if x,y is not a valid coordinate within the grid or the state is not from 0 to 15.
+ */
+void StateGrid::set(int x, int y, int state){
+    //exception
+    if(x >= get_width() || y >= get_height() || x<0 || y<0){
+        throw std::runtime_error("not within bounds");
+    }
+    //exception
+    if(state < 0 || state > 15){
+        throw std::runtime_error("state must be from 0 to 15");
+    }
+    int index = get_index(x, y);
+    int shift = (index % 2) * 4;
+    gridCells[index / 2] = std::uint8_t((gridCells[index / 2] & ~(0xF << shift)) | (state << shift));
+}
+
+/**
+ * StateGrid::unpack_row(y, states)
+ *
+ * Copies a row of the grid out to one byte per cell.
+ * The function should be callable from a constant context.
+ *
+ * @param y
+ *      The y coordinate of the row to unpack.
+ *
+ * @param states
+ *      Pointer to at least StateGrid::get_width() bytes to write the states into.
+ *
+ * @throws
+ *      std::exception or sub-class if y is not a valid row within the grid.
+ */
+void StateGrid::unpack_row(int y, std::uint8_t* states) const{
+    //exception
+    if(y >= get_height() || y < 0){
+        throw std::runtime_error("not within bounds");
+    }
+    int index = get_index(0, y);
+
+    //loop that splits each cell out of its half byte
+    for(int x = 0; x < width; x++, index++){
+        states[x] = (gridCells[index / 2] >> ((index % 2) * 4)) & 0xF;
+    }
+}
+
+/**
+ * StateGrid::pack_row(y, states)
+ *
+ * Overwrites a row of the grid from one byte per cell.
+ *
+ * @param y
+ *      The y coordinate of the row to pack.
+ *
+ * @param states
+ *      Pointer to at least StateGrid::get_width() bytes holding states from 0 to 15.
+ *
+ * @throws
+ *      std::exception or sub-class if y is not a valid row within the grid.
+ */
+void StateGrid::pack_row(int y, const std::uint8_t* states){
+    //exception
+    if(y >= get_height() || y < 0){
+        throw std::runtime_error("not within bounds");
+    }
+    int index = get_index(0, y);
+
+    //loop that merges each cell into its half byte
+    for(int x = 0; x < width; x++, index++){
+        int shift = (index % 2) * 4;
+        gridCells[index / 2] = std::uint8_t((gridCells[index / 2] & ~(0xF << shift)) | ((states[x] & 0xF) << shift));
+    }
+}
+
+/**
+ * StateGrid::to_grid()
+ *
+ * Create a two state Grid of the same size with the alive (state 1) cells set to Cell::ALIVE.
+ * Dying cells become Cell::DEAD.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      Returns the alive cells as a Grid.
+ */
+Grid StateGrid::to_grid() const{
+    Grid grid(width, height);
+    std::vector<std::uint8_t> row(width);
+
+    //nested loops that copy each alive cell across
+    for(int y = 0; y < height; y++){
+        unpack_row(y, row.data());
+        for(int x = 0; x < width; x++){
+            if(row[x] == 1){
+                grid(x, y) = Cell::ALIVE;
+            }
+        }
+    }
+    return grid;
+}
+
+/**
+ * operator<<(output_stream, grid)
+ *
+ * Serializes a grid to an ascii output stream, in the same bordered style as Grid.
+ * Dead cells are shown as ' ' (space), alive cells as '#' (hash), and dying cells as their state in hex, '2' to 'f'.
+ *
+ * @example
+ *
+ *      // Make a 3x1 grid with an alive and a dying cell
+ *      StateGrid grid(3, 1);
+ *      grid.set(0, 0, 1);
+ *      grid.set(1, 0, 2);
+ *
+ *      // Print the grid to the console
+ *      std::cout << grid << std::endl;
+ *
+ *      +---+
+ *      |#2 |
+ *      +---+
+ *
+ * @param os
+ *      An ascii mode output stream such as std::cout.
+ *
+ * @param grid
+ *      A grid object containing cells to be printed.
+ *
+ * @return
+ *      Returns a reference to the output stream to enable operator chaining.
+ */
+std::ostream& operator<<(std::ostream& os, const StateGrid& grid){
+    const char* symbols = " #23456789abcdef";
+    os << "+" ;
+    for(int z = 0; z < grid.get_width(); z++){
+        os << "-";
+    }
+    os << "+" << "\n";
+    for(int j = 0; j < grid.get_height(); j++){
+        os << "|";
+        for(int i = 0; i < grid.get_width(); i++){
+            os << symbols[grid.get(i, j)];
+        }
+        os << "|\n";
+    }
+
+    os << "+" ;
+    for(int z = 0; z < grid.get_width(); z++){
+        os << "-";
+    }
+    os << "+" << "\n";
+    return os;
+}
@@ -0,0 +1,48 @@
+/**
+ * Declares a class representing a 2d grid of multi-state cells, packed two cells to a byte.
+ * Rich documentation for the api and behaviour the StateGrid class can be found in state_grid.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include <vector>
+#include <iostream>
+#include <cstdint>
+
+/**
+ * Declare the structure of the StateGrid class for representing a 2d grid of cells with up to 16 states.
+ */
+class StateGrid {
+    private:
+        int width;
+        int height;
+        std::vector<std::uint8_t> gridCells;
+
+        int get_index(int x, int y) const;
+    public:
+        StateGrid();
+        explicit StateGrid(int square_size);
+        StateGrid(int width, int height);
+        explicit StateGrid(const Grid& grid);
+
+        int get_width() const;
+        int get_height() const;
+        int get_total_cells() const;
+        int get_alive_cells() const;
+        int get_dead_cells() const;
+
+        int get(int x, int y) const;
+        void set(int x, int y, int state);
+
+        void unpack_row(int y, std::uint8_t* states) const;
+        void pack_row(int y, const std::uint8_t* states);
+
+        Grid to_grid() const;
+
+        friend std::ostream& operator<<(std::ostream& os, const StateGrid& grid);
+};
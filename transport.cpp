@@ -0,0 +1,683 @@
+/**
+ * Implements the Transport classes for passing messages between the processes of a distributed simulation.
+ *      - Each process is a rank numbered from 0, and any rank can send a message of bytes to any other rank,
+ *        including itself.
+ *          - Messages between two ranks arrive whole and in the order they were sent.
+ *          - Sending only waits if the way to the other rank is full, so a rank can send to all of its
+ *            neighbours and get on with other work before receiving from them.
+ *          - While a send waits, the rank reads whatever has arrived for it into memory, to be handed out by later
+ *            receives. So ranks that all send large messages to each other before any of them receives still get
+ *            through, however small the ways between them are.
+ *
+ *      - SharedMemoryTransport is for ranks on the same machine.
+ *          - Rank 0 creates a POSIX shared memory segment with the given name, and the other ranks open it.
+ *          - The segment holds a ring buffer of bytes for every ordered pair of ranks, each with one writer and one
+ *            reader, whose read and write positions are std::atomic counters in the segment.
+ *          - Messages are written as their length then their bytes, in pieces as space frees up, so messages larger
+ *            than a ring buffer still get through.
+ *          - The segment is ranks * ranks * capacity bytes long, but is only backed by memory where it is written,
+ *            so it uses about capacity bytes for each pair of ranks that actually talk, such as neighbouring
+ *            subdomains. Its address space still grows with the square of the ranks, so the capacity should be kept
+ *            small when there are many ranks.
+ *
+ *      - TcpTransport is for ranks that talk over the network, or over the loopback interface on one machine.
+ *          - Rank r listens on port + r, connects to every lower rank and accepts a connection from every
+ *            higher one, so each pair of ranks shares one connection.
+ *          - Messages are written as their length then their bytes, with Nagle's algorithm turned off so small
+ *            messages are not held back.
+ *          - Messages a rank sends to itself are queued in memory.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "transport.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//the segment starts with a ready flag, and each channel with its write then read position, each on its own line
+static const std::size_t LINE = 64;
+
+/**
+ * SharedMemoryTransport::SharedMemoryTransport(name, rank, ranks, capacity)
+ *
+ * Join a group of ranks passing messages through shared memory. Every rank must use the same name, number of ranks
+ * and capacity. Rank 0 creates the segment, and the other ranks wait for it to be ready.
+ *
+ * @example
+ *
+ *      // Join as rank 2 of 4
+ *      SharedMemoryTransport transport("/life_run_1", 2, 4);
+ *
+ * @param name
+ *      The name of the shared memory segment, starting with a '/' and unique to this run.
+ *
+ * @param rank
+ *      The rank of this process, from 0 to ranks - 1.
+ *
+ * @param ranks
+ *      The number of ranks.
+ *
+ * @param capacity
+ *      Optional parameter. The number of bytes in the ring buffer between each pair of ranks. Defaults to 1 MiB.
+ *      Messages of any size get through, and the segment is ranks * ranks * capacity bytes of address space.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The rank is not within the ranks, the capacity is less than 64 bytes, or the segment would be more than
+ *            2^46 bytes.
+ *          - Rank 0 cannot create the segment, for example because one with the same name is left from another run.
+ *          - The segment cannot be mapped.
+ */
+SharedMemoryTransport::SharedMemoryTransport(std::string name, int rank, int ranks, std::size_t capacity){
+    //exception
+    if(ranks < 1 || rank < 0 || rank >= ranks || capacity < LINE){
+        throw std::runtime_error("rank not within the ranks or capacity too small");
+    }
+    //exception
+    if(capacity > (std::size_t(1) << 46) / (std::size_t(ranks) * ranks)){
+        throw std::runtime_error("shared memory too large for the ranks and capacity");
+    }
+    this->name = name;
+    this->rank = rank;
+    this->ranks = ranks;
+    this->capacity = capacity;
+    this->size = LINE + (std::size_t(ranks) * ranks * ((2 * LINE) + capacity));
+    this->memory = nullptr;
+    this->pending.assign(ranks, std::vector<std::uint8_t>());
+    this->pendingRead.assign(ranks, 0);
+
+    int descriptor = -1;
+    if(rank == 0){
+        descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        //exception
+        if(descriptor < 0 || ftruncate(descriptor, off_t(size)) != 0){
+            if(descriptor >= 0){
+                close(descriptor);
+                shm_unlink(name.c_str());
+            }
+            throw std::runtime_error("can't create shared memory " + name);
+        }
+    }
+    else{
+        //wait for rank 0 to create the segment and give it its full size
+        struct stat status;
+        while((descriptor = shm_open(name.c_str(), O_RDWR, 0600)) < 0 ||
+              fstat(descriptor, &status) != 0 || std::size_t(status.st_size) < size){
+            if(descriptor >= 0){
+                close(descriptor);
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    void* mapped = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    //exception
+    if(mapped == MAP_FAILED){
+        throw std::runtime_error("can't map shared memory " + name);
+    }
+    memory = static_cast<std::uint8_t*>(mapped);
+
+    //a new segment is all zeros, which are empty channels, so rank 0 only has to say it is ready
+    std::atomic<std::uint32_t>* ready = reinterpret_cast<std::atomic<std::uint32_t>*>(memory);
+    if(rank == 0){
+        ready->store(1, std::memory_order_release);
+    }
+    while(ready->load(std::memory_order_acquire) != 1){
+        std::this_thread::yield();
+    }
+}
+
+/**
+ * SharedMemoryTransport::~SharedMemoryTransport()
+ *
+ * Unmap the segment. Rank 0 also removes its name, so it is gone once every rank has unmapped it.
+ */
+SharedMemoryTransport::~SharedMemoryTransport(){
+    munmap(memory, size);
+    if(rank == 0){
+        shm_unlink(name.c_str());
+    }
+}
+
+/**
+ * SharedMemoryTransport::get_channel(from, to)
+ *
+ * Gets the start of the channel carrying messages from one rank to another, which is its write position, then its
+ * read position, then its ring buffer of bytes.
+ * The function should be callable from a constant context.
+ */
+std::uint8_t* SharedMemoryTransport::get_channel(int from, int to) const{
+    return memory + LINE + ((std::size_t(from) * ranks + to) * ((2 * LINE) + capacity));
+}
+
+/**
+ * take_pending(pending, pending_read, bytes, count)
+ *
+ * Helper to hand out up to count bytes already read into memory for a rank, returning how many there were.
+ */
+static std::size_t take_pending(std::vector<std::uint8_t>& pending, std::size_t& pending_read, std::uint8_t* bytes,
+                                std::size_t count){
+    std::size_t piece = std::min(count, pending.size() - pending_read);
+    std::memcpy(bytes, pending.data() + pending_read, piece);
+    pending_read += piece;
+    if(pending_read == pending.size()){
+        pending.clear();
+        pending_read = 0;
+    }
+    return piece;
+}
+
+/**
+ * SharedMemoryTransport::drain()
+ *
+ * Private helper function to read everything waiting in the channels to this rank into memory, so the ranks sending
+ * on them can go on while this one is itself waiting to send. Returns whether anything was read.
+ */
+bool SharedMemoryTransport::drain(){
+    bool drained = false;
+    for(int from = 0; from < ranks; from++){
+        std::uint8_t* channel = get_channel(from, rank);
+        std::atomic<std::uint64_t>* head = reinterpret_cast<std::atomic<std::uint64_t>*>(channel);
+        std::atomic<std::uint64_t>* tail = reinterpret_cast<std::atomic<std::uint64_t>*>(channel + LINE);
+        std::uint8_t* ring = channel + (2 * LINE);
+
+        std::uint64_t read = tail->load(std::memory_order_relaxed);
+        std::size_t waiting = std::size_t(head->load(std::memory_order_acquire) - read);
+        while(waiting > 0){
+            std::size_t offset = std::size_t(read % capacity);
+            std::size_t piece = std::min(waiting, capacity - offset);
+            pending[from].insert(pending[from].end(), ring + offset, ring + offset + piece);
+            read += piece;
+            waiting -= piece;
+            drained = true;
+        }
+        tail->store(read, std::memory_order_release);
+    }
+    return drained;
+}
+
+/**
+ * SharedMemoryTransport::write_bytes(to, bytes, count)
+ *
+ * Write bytes to the channel to a rank, draining the channels to this rank whenever the ring buffer is full, and
+ * waiting for the reader if there was nothing to drain.
+ */
+void SharedMemoryTransport::write_bytes(int to, const std::uint8_t* bytes, std::size_t count){
+    std::uint8_t* channel = get_channel(rank, to);
+    std::atomic<std::uint64_t>* head = reinterpret_cast<std::atomic<std::uint64_t>*>(channel);
+    std::atomic<std::uint64_t>* tail = reinterpret_cast<std::atomic<std::uint64_t>*>(channel + LINE);
+    std::uint8_t* ring = channel + (2 * LINE);
+
+    std::uint64_t written = head->load(std::memory_order_relaxed);
+    while(count > 0){
+        std::size_t space = capacity - std::size_t(written - tail->load(std::memory_order_acquire));
+        if(space == 0){
+            if(!drain()){
+                std::this_thread::yield();
+            }
+            continue;
+        }
+        //copy as much as fits before the end of the ring, then publish it
+        std::size_t offset = std::size_t(written % capacity);
+        std::size_t piece = std::min(count, std::min(space, capacity - offset));
+        std::memcpy(ring + offset, bytes, piece);
+        written += piece;
+        head->store(written, std::memory_order_release);
+        bytes += piece;
+        count -= piece;
+    }
+}
+
+/**
+ * SharedMemoryTransport::read_bytes(from, bytes, count)
+ *
+ * Read bytes from the channel from a rank, first from those already drained into memory, waiting for the writer
+ * whenever the ring buffer is empty.
+ */
+void SharedMemoryTransport::read_bytes(int from, std::uint8_t* bytes, std::size_t count){
+    std::size_t taken = take_pending(pending[from], pendingRead[from], bytes, count);
+    bytes += taken;
+    count -= taken;
+
+    std::uint8_t* channel = get_channel(from, rank);
+    std::atomic<std::uint64_t>* head = reinterpret_cast<std::atomic<std::uint64_t>*>(channel);
+    std::atomic<std::uint64_t>* tail = reinterpret_cast<std::atomic<std::uint64_t>*>(channel + LINE);
+    std::uint8_t* ring = channel + (2 * LINE);
+
+    std::uint64_t read = tail->load(std::memory_order_relaxed);
+    while(count > 0){
+        std::size_t waiting = std::size_t(head->load(std::memory_order_acquire) - read);
+        if(waiting == 0){
+            std::this_thread::yield();
+            continue;
+        }
+        //copy as much as is there before the end of the ring, then hand the space back
+        std::size_t offset = std::size_t(read % capacity);
+        std::size_t piece = std::min(count, std::min(waiting, capacity - offset));
+        std::memcpy(bytes, ring + offset, piece);
+        read += piece;
+        tail->store(read, std::memory_order_release);
+        bytes += piece;
+        count -= piece;
+    }
+}
+
+/**
+ * SharedMemoryTransport::get_rank()
+ *
+ * Gets the rank of this process.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The rank of this process.
+ */
+int SharedMemoryTransport::get_rank() const{
+    return this->rank;
+}
+
+/**
+ * SharedMemoryTransport::get_ranks()
+ *
+ * Gets the number of ranks.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of ranks.
+ */
+int SharedMemoryTransport::get_ranks() const{
+    return this->ranks;
+}
+
+/**
+ * SharedMemoryTransport::send(rank, message)
+ *
+ * Send a message to a rank. Only waits if the ring buffer to that rank fills up, reading what other ranks send
+ * meanwhile into memory.
+ *
+ * @param rank
+ *      The rank to send to, which can be this one.
+ *
+ * @param message
+ *      The bytes to send.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the rank is not within the ranks.
+ */
+void SharedMemoryTransport::send(int rank, const std::vector<std::uint8_t>& message){
+    //exception
+    if(rank < 0 || rank >= ranks){
+        throw std::runtime_error("rank not within the ranks");
+    }
+    std::uint64_t length = message.size();
+    write_bytes(rank, reinterpret_cast<const std::uint8_t*>(&length), sizeof(length));
+    write_bytes(rank, message.data(), message.size());
+}
+
+/**
+ * SharedMemoryTransport::receive(rank)
+ *
+ * Receive the next message from a rank, waiting for it to arrive.
+ *
+ * @param rank
+ *      The rank to receive from, which can be this one.
+ *
+ * @return
+ *      The bytes of the message.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the rank is not within the ranks.
+ */
+std::vector<std::uint8_t> SharedMemoryTransport::receive(int rank){
+    //exception
+    if(rank < 0 || rank >= ranks){
+        throw std::runtime_error("rank not within the ranks");
+    }
+    std::uint64_t length = 0;
+    read_bytes(rank, reinterpret_cast<std::uint8_t*>(&length), sizeof(length));
+    std::vector<std::uint8_t> message(length);
+    read_bytes(rank, message.data(), message.size());
+    return message;
+}
+
+/**
+ * write_all(socket, bytes, count)
+ *
+ * Helper to write every byte to a socket, however many calls it takes.
+ */
+static void write_all(int socket, const std::uint8_t* bytes, std::size_t count){
+    while(count > 0){
+        ssize_t written = ::send(socket, bytes, count, MSG_NOSIGNAL);
+        //exception
+        if(written <= 0){
+            throw std::runtime_error("connection lost");
+        }
+        bytes += written;
+        count -= std::size_t(written);
+    }
+}
+
+/**
+ * read_all(socket, bytes, count)
+ *
+ * Helper to read exactly count bytes from a socket, however many calls it takes.
+ */
+static void read_all(int socket, std::uint8_t* bytes, std::size_t count){
+    while(count > 0){
+        ssize_t read = ::recv(socket, bytes, count, 0);
+        //exception
+        if(read <= 0){
+            throw std::runtime_error("connection lost");
+        }
+        bytes += read;
+        count -= std::size_t(read);
+    }
+}
+
+/**
+ * TcpTransport::TcpTransport(rank, ranks, port, host)
+ *
+ * Join a group of ranks passing messages over TCP, connecting to every other rank before returning.
+ * Every rank must use the same number of ranks, port and host.
+ *
+ * @example
+ *
+ *      // Join as rank 1 of 2 on this machine, listening on port 5001 and connecting to rank 0 on port 5000
+ *      TcpTransport transport(1, 2, 5000);
+ *
+ * @param rank
+ *      The rank of this process, from 0 to ranks - 1.
+ *
+ * @param ranks
+ *      The number of ranks.
+ *
+ * @param port
+ *      The port rank 0 listens on. Rank r listens on port + r.
+ *
+ * @param host
+ *      Optional parameter. The IPv4 address every rank listens on. Defaults to the loopback address.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the rank is not within the ranks, the port cannot be listened on,
+ *      a lower rank cannot be reached within 10 seconds, or a connection is lost or claims a rank that is not a
+ *      higher one still to connect. Every socket opened is closed before throwing.
+ */
+TcpTransport::TcpTransport(int rank, int ranks, int port, std::string host){
+    //exception
+    if(ranks < 1 || rank < 0 || rank >= ranks){
+        throw std::runtime_error("rank not within the ranks");
+    }
+    this->rank = rank;
+    this->ranks = ranks;
+    sockets.assign(ranks, -1);
+    pending.assign(ranks, std::vector<std::uint8_t>());
+    pendingRead.assign(ranks, 0);
+
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    //exception
+    if(inet_pton(AF_INET, host.c_str(), &address.sin_addr) != 1){
+        throw std::runtime_error("not an IPv4 address " + host);
+    }
+
+    //listen first so the higher ranks can connect while this one connects to the lower ones
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    int on = 1;
+    setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    address.sin_port = htons(std::uint16_t(port + rank));
+    //exception
+    if(listener < 0 || bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+       listen(listener, ranks) != 0){
+        if(listener >= 0){
+            close(listener);
+        }
+        throw std::runtime_error("can't listen on port " + std::to_string(port + rank));
+    }
+
+    //every error from here on closes the listener and the connections made so far before passing it on
+    try{
+        for(int other = 0; other < rank; other++){
+            address.sin_port = htons(std::uint16_t(port + other));
+            auto start = std::chrono::steady_clock::now();
+            int connection = -1;
+            while(connection < 0){
+                connection = socket(AF_INET, SOCK_STREAM, 0);
+                //exception
+                if(connection < 0){
+                    throw std::runtime_error("can't open a socket to rank " + std::to_string(other));
+                }
+                if(connect(connection, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0){
+                    close(connection);
+                    connection = -1;
+                    //exception
+                    if(std::chrono::steady_clock::now() - start > std::chrono::seconds(10)){
+                        throw std::runtime_error("can't connect to rank " + std::to_string(other));
+                    }
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            }
+            sockets[other] = connection;
+            std::int32_t self = rank;
+            write_all(connection, reinterpret_cast<const std::uint8_t*>(&self), sizeof(self));
+        }
+        for(int accepted = rank + 1; accepted < ranks; accepted++){
+            int connection = accept(listener, nullptr, nullptr);
+            //exception
+            if(connection < 0){
+                throw std::runtime_error("can't accept a connection on port " + std::to_string(port + rank));
+            }
+            std::int32_t other = -1;
+            try{
+                read_all(connection, reinterpret_cast<std::uint8_t*>(&other), sizeof(other));
+            }catch(...){
+                close(connection);
+                throw;
+            }
+            //exception
+            if(other <= rank || other >= ranks || sockets[other] >= 0){
+                close(connection);
+                throw std::runtime_error("connection from an unexpected rank " + std::to_string(other));
+            }
+            sockets[other] = connection;
+        }
+    }catch(...){
+        close(listener);
+        for(int& connection : sockets){
+            if(connection >= 0){
+                close(connection);
+                connection = -1;
+            }
+        }
+        throw;
+    }
+    close(listener);
+
+    for(int connection : sockets){
+        if(connection >= 0){
+            setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        }
+    }
+}
+
+/**
+ * TcpTransport::~TcpTransport()
+ *
+ * Close every connection.
+ */
+TcpTransport::~TcpTransport(){
+    for(int connection : sockets){
+        if(connection >= 0){
+            close(connection);
+        }
+    }
+}
+
+/**
+ * TcpTransport::get_rank()
+ *
+ * Gets the rank of this process.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The rank of this process.
+ */
+int TcpTransport::get_rank() const{
+    return this->rank;
+}
+
+/**
+ * TcpTransport::get_ranks()
+ *
+ * Gets the number of ranks.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of ranks.
+ */
+int TcpTransport::get_ranks() const{
+    return this->ranks;
+}
+
+/**
+ * TcpTransport::write_bytes(to, bytes, count)
+ *
+ * Private helper function to write bytes to the connection to a rank. Whenever the connection can't take more, it
+ * waits for it or for any other connection to have something to read, and reads that into memory for later
+ * receives, so two ranks sending to each other at once don't both wait for the other to read.
+ */
+void TcpTransport::write_bytes(int to, const std::uint8_t* bytes, std::size_t count){
+    std::vector<pollfd> waits(ranks);
+    std::vector<std::uint8_t> buffer(1 << 16);
+    while(count > 0){
+        ssize_t written = ::send(sockets[to], bytes, count, MSG_NOSIGNAL | MSG_DONTWAIT);
+        if(written > 0){
+            bytes += written;
+            count -= std::size_t(written);
+            continue;
+        }
+        //exception
+        if(written == 0 || (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)){
+            throw std::runtime_error("connection lost");
+        }
+
+        //wait until the connection can take more, reading whatever arrives in the meantime
+        for(int other = 0; other < ranks; other++){
+            waits[other].fd = sockets[other];
+            waits[other].events = short((other == to) ? (POLLIN | POLLOUT) : POLLIN);
+            waits[other].revents = 0;
+        }
+        if(poll(waits.data(), nfds_t(ranks), -1) < 0){
+            //exception
+            if(errno != EINTR){
+                throw std::runtime_error("can't wait on the connections");
+            }
+            continue;
+        }
+        for(int other = 0; other < ranks; other++){
+            if(!(waits[other].revents & (POLLIN | POLLHUP | POLLERR))){
+                continue;
+            }
+            ssize_t read = ::recv(sockets[other], buffer.data(), buffer.size(), MSG_DONTWAIT);
+            //exception
+            if(read == 0 || (read < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)){
+                throw std::runtime_error("connection lost");
+            }
+            if(read > 0){
+                pending[other].insert(pending[other].end(), buffer.data(), buffer.data() + read);
+            }
+        }
+    }
+}
+
+/**
+ * TcpTransport::read_bytes(from, bytes, count)
+ *
+ * Private helper function to read bytes from the connection to a rank, first from those already read into memory
+ * while sending.
+ */
+void TcpTransport::read_bytes(int from, std::uint8_t* bytes, std::size_t count){
+    std::size_t taken = take_pending(pending[from], pendingRead[from], bytes, count);
+    read_all(sockets[from], bytes + taken, count - taken);
+}
+
+/**
+ * TcpTransport::send(rank, message)
+ *
+ * Send a message to a rank. Only waits if the connection's send buffer fills up, reading what other ranks send
+ * meanwhile into memory.
+ *
+ * @param rank
+ *      The rank to send to, which can be this one.
+ *
+ * @param message
+ *      The bytes to send.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the rank is not within the ranks or the connection is lost.
+ */
+void TcpTransport::send(int rank, const std::vector<std::uint8_t>& message){
+    //exception
+    if(rank < 0 || rank >= ranks){
+        throw std::runtime_error("rank not within the ranks");
+    }
+    if(rank == this->rank){
+        loopback.push_back(message);
+        return;
+    }
+    std::uint64_t length = message.size();
+    write_bytes(rank, reinterpret_cast<const std::uint8_t*>(&length), sizeof(length));
+    write_bytes(rank, message.data(), message.size());
+}
+
+/**
+ * TcpTransport::receive(rank)
+ *
+ * Receive the next message from a rank, waiting for it to arrive.
+ *
+ * @param rank
+ *      The rank to receive from, which can be this one if it has sent itself a message.
+ *
+ * @return
+ *      The bytes of the message.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the rank is not within the ranks, the connection is lost, or this
+ *      rank is waiting on a message to itself that was never sent.
+ */
+std::vector<std::uint8_t> TcpTransport::receive(int rank){
+    //exception
+    if(rank < 0 || rank >= ranks){
+        throw std::runtime_error("rank not within the ranks");
+    }
+    if(rank == this->rank){
+        //exception
+        if(loopback.empty()){
+            throw std::runtime_error("no message sent to self");
+        }
+        std::vector<std::uint8_t> message = loopback.front();
+        loopback.pop_front();
+        return message;
+    }
+    std::uint64_t length = 0;
+    read_bytes(rank, reinterpret_cast<std::uint8_t*>(&length), sizeof(length));
+    std::vector<std::uint8_t> message(length);
+    read_bytes(rank, message.data(), message.size());
+    return message;
+}
@@ -0,0 +1,89 @@
+/**
+ * Declares the Transport classes for passing messages between the processes of a distributed simulation.
+ * Rich documentation for the api and behaviour the Transport classes can be found in transport.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+/**
+ * Declare the interface of the Transport class, which every way of passing messages between ranks implements.
+ */
+class Transport {
+    public:
+        virtual ~Transport() = default;
+
+        virtual int get_rank() const = 0;
+        virtual int get_ranks() const = 0;
+        virtual void send(int rank, const std::vector<std::uint8_t>& message) = 0;
+        virtual std::vector<std::uint8_t> receive(int rank) = 0;
+};
+
+/**
+ * Declare the structure of the SharedMemoryTransport class, which passes messages through a POSIX shared memory
+ * segment holding a ring buffer for every pair of ranks.
+ */
+class SharedMemoryTransport : public Transport {
+    private:
+        std::string name;
+        int rank;
+        int ranks;
+        std::size_t capacity;
+        std::size_t size;
+        std::uint8_t* memory;
+        std::vector<std::vector<std::uint8_t>> pending;
+        std::vector<std::size_t> pendingRead;
+
+        std::uint8_t* get_channel(int from, int to) const;
+        bool drain();
+        void write_bytes(int to, const std::uint8_t* bytes, std::size_t count);
+        void read_bytes(int from, std::uint8_t* bytes, std::size_t count);
+
+    public:
+        SharedMemoryTransport(std::string name, int rank, int ranks, std::size_t capacity = 1 << 20);
+        ~SharedMemoryTransport() override;
+        SharedMemoryTransport(const SharedMemoryTransport&) = delete;
+        SharedMemoryTransport& operator=(const SharedMemoryTransport&) = delete;
+
+        int get_rank() const override;
+        int get_ranks() const override;
+        void send(int rank, const std::vector<std::uint8_t>& message) override;
+        std::vector<std::uint8_t> receive(int rank) override;
+};
+
+/**
+ * Declare the structure of the TcpTransport class, which passes messages over a TCP connection between every pair
+ * of ranks, with rank r listening on port + r.
+ */
+class TcpTransport : public Transport {
+    private:
+        int rank;
+        int ranks;
+        std::vector<int> sockets;
+        std::deque<std::vector<std::uint8_t>> loopback;
+        std::vector<std::vector<std::uint8_t>> pending;
+        std::vector<std::size_t> pendingRead;
+
+        void write_bytes(int to, const std::uint8_t* bytes, std::size_t count);
+        void read_bytes(int from, std::uint8_t* bytes, std::size_t count);
+
+    public:
+        TcpTransport(int rank, int ranks, int port, std::string host = "127.0.0.1");
+        ~TcpTransport() override;
+        TcpTransport(const TcpTransport&) = delete;
+        TcpTransport& operator=(const TcpTransport&) = delete;
+
+        int get_rank() const override;
+        int get_ranks() const override;
+        void send(int rank, const std::vector<std::uint8_t>& message) override;
+        std::vector<std::uint8_t> receive(int rank) override;
+};
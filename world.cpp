@@ -10,13 +10,22 @@
  *
  *      - Stepping a world forward in time applies the rules of Conway's Game of Life.
  *          - https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life
- *
- *      - Worlds have a private helper function used to count the number of alive cells in a 3x3 neighbours
- *        around a given cell.
+ *          - Any other Life-like Rule can be used instead, such as B36/S23 (HighLife).
+ *          - Conway's rule keeps its own compile time specialised step, other rules use a lookup table.
  *
  *      - Updating the world state can conditionally be performed using a toroidal topology.
  *          - Moving off the left edge you appear on the right edge and vice versa.
  *          - Moving off the top edge you appear on the bottom edge and vice versa.
+ *          - Other topologies join the edges as cylinders, a Klein bottle or a cross-surface, or fix the
+ *            cells beyond the edges as alive, see Topology.
+ *          - The cells just beyond the edges are filled into a halo once per step, so the step itself
+ *            never checks for edges.
+ *
+ *      - Worlds track the bounding box of their alive cells.
+ *          - Only the box grown by one cell can change in a step, so the rest of the world is skipped.
+ *
+ *      - Worlds count the generations they have stepped through.
+ *          - Advancing can stop early once the world dies out, settles to a still life, or starts to oscillate.
  *
  * @author 931478
  * @date 17th April, 2020
@@ -25,6 +34,216 @@
 
 // Include the minimal number of headers needed to support your implementation.
 // #include ...
+#include "band_pool.h"
+#include "frame_ring.h"
+#include "world_snapshot.h"
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <sched.h>
+#include <sys/mman.h>
+
+//regions with fewer cells than this are stepped by the calling thread alone, as threads would cost more than they save
+static const long long PARALLEL_CELLS = 1 << 16;
+
+//the width and height of the tiles a region is split into for the threads to share
+static const int TILE = 64;
+
+/**
+ * grow_bounds(box, margin, width, height)
+ *
+ * Helper to pad a box by a margin on every side, clipped to a width x height area.
+ * Empty boxes stay empty.
+ */
+static Bounds grow_bounds(Bounds box, int margin, int width, int height){
+    if(box.x0 >= box.x1 || box.y0 >= box.y1){
+        return {0, 0, 0, 0};
+    }
+    return {std::max(box.x0 - margin, 0), std::max(box.y0 - margin, 0),
+            std::min(box.x1 + margin, width), std::min(box.y1 + margin, height)};
+}
+
+/**
+ * clip_bounds(box, area)
+ *
+ * Helper to find the part of a box inside an area, or an empty box if they don't overlap.
+ */
+static Bounds clip_bounds(Bounds box, Bounds area){
+    Bounds part = {std::max(box.x0, area.x0), std::max(box.y0, area.y0),
+                   std::min(box.x1, area.x1), std::min(box.y1, area.y1)};
+    if(part.x0 >= part.x1 || part.y0 >= part.y1){
+        return {0, 0, 0, 0};
+    }
+    return part;
+}
+
+/**
+ * merge_bounds(a, b)
+ *
+ * Helper to find the smallest box covering both boxes, where either may be empty.
+ */
+static Bounds merge_bounds(Bounds a, Bounds b){
+    if(a.x0 >= a.x1 || a.y0 >= a.y1){
+        return b;
+    }
+    if(b.x0 >= b.x1 || b.y0 >= b.y1){
+        return a;
+    }
+    return {std::min(a.x0, b.x0), std::min(a.y0, b.y0), std::max(a.x1, b.x1), std::max(a.y1, b.y1)};
+}
+
+/**
+ * read_cpu_list(path)
+ *
+ * Helper to read a list of cpus such as "0-3,8-11" from a file under /sys, or an empty list if it can't be read.
+ */
+static std::vector<int> read_cpu_list(const std::string& path){
+    std::vector<int> cpus;
+    std::ifstream file(path);
+    std::string list;
+    if(!std::getline(file, list)){
+        return cpus;
+    }
+    std::stringstream ranges(list);
+    std::string range;
+    while(std::getline(ranges, range, ',')){
+        std::size_t dash = range.find('-');
+        if(range.empty() || !std::isdigit(static_cast<unsigned char>(range[0]))){
+            continue;
+        }
+        int first = std::stoi(range.substr(0, dash));
+        int last = (dash == std::string::npos) ? first : std::stoi(range.substr(dash + 1));
+        for(int cpu = first; cpu <= last; cpu++){
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+/**
+ * get_cpus(threads)
+ *
+ * Helper to choose a cpu for each of a number of threads from the cpus the process may run on. The threads are
+ * spread evenly over the NUMA nodes, consecutive threads sharing a node, and within a node the first hardware thread
+ * of every core is used before any second ones. A machine without NUMA information is treated as one node.
+ */
+static std::vector<int> get_cpus(int threads){
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if(sched_getaffinity(0, sizeof(allowed), &allowed) != 0){
+        for(int cpu = 0; cpu < int(std::thread::hardware_concurrency()) && cpu < CPU_SETSIZE; cpu++){
+            CPU_SET(cpu, &allowed);
+        }
+    }
+
+    //loop that groups the allowed cpus by node, stopping at the first node that isn't there
+    std::vector<std::vector<int>> nodes;
+    for(int node = 0; ; node++){
+        std::vector<int> cpus = read_cpu_list("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if(cpus.empty()){
+            break;
+        }
+        std::vector<int> usable;
+        for(int cpu : cpus){
+            if(cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)){
+                usable.push_back(cpu);
+            }
+        }
+        if(!usable.empty()){
+            nodes.push_back(usable);
+        }
+    }
+    if(nodes.empty()){
+        nodes.emplace_back();
+        for(int cpu = 0; cpu < CPU_SETSIZE; cpu++){
+            if(CPU_ISSET(cpu, &allowed)){
+                nodes[0].push_back(cpu);
+            }
+        }
+    }
+
+    //order each node's cpus by their place among the hardware threads of their core
+    for(std::vector<int>& cpus : nodes){
+        std::vector<std::pair<int, int>> ranked;
+        for(int cpu : cpus){
+            std::vector<int> siblings = read_cpu_list("/sys/devices/system/cpu/cpu" + std::to_string(cpu) +
+                                                      "/topology/thread_siblings_list");
+            int rank = int(std::find(siblings.begin(), siblings.end(), cpu) - siblings.begin());
+            ranked.push_back({rank == int(siblings.size()) ? 0 : rank, cpu});
+        }
+        std::sort(ranked.begin(), ranked.end());
+        for(std::size_t i = 0; i < cpus.size(); i++){
+            cpus[i] = ranked[i].second;
+        }
+    }
+
+    //loop that gives thread t the next cpu of node t * nodes / threads
+    std::vector<int> chosen(threads);
+    int count = int(nodes.size());
+    for(int t = 0; t < threads; t++){
+        int node = int((std::int64_t(t) * count) / threads);
+        int first = int((std::int64_t(node) * threads + count - 1) / count);
+        chosen[t] = nodes[node][(t - first) % nodes[node].size()];
+    }
+    return chosen;
+}
+
+/**
+ * advise_huge_pages(cells, count)
+ *
+ * Helper to ask for the whole huge pages within a block of cells to be backed by transparent huge pages.
+ * Large blocks of cells are aligned to a huge page, see allocate_cells(bytes), so this covers nearly all of them.
+ */
+static void advise_huge_pages(Cell* cells, std::size_t count){
+    const std::uintptr_t page = std::uintptr_t(1) << 21;
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(cells);
+    std::uintptr_t end = (start + count) & ~(page - 1);
+    start = (start + page - 1) & ~(page - 1);
+    if(end > start){
+        madvise(reinterpret_cast<void*>(start), end - start, MADV_HUGEPAGE);
+    }
+}
+
+namespace {
+
+/**
+ * TileDeque
+ *
+ * A double ended queue of tiles for work stealing. The thread that owns it takes tiles from the back, and idle
+ * threads steal them from the front, so a thief takes the tile its owner would have reached last.
+ */
+struct TileDeque {
+    std::mutex lock;
+    std::deque<int> tiles;
+
+    bool pop(int& tile){
+        std::lock_guard<std::mutex> guard(lock);
+        if(tiles.empty()){
+            return false;
+        }
+        tile = tiles.back();
+        tiles.pop_back();
+        return true;
+    }
+
+    bool steal(int& tile){
+        std::lock_guard<std::mutex> guard(lock);
+        if(tiles.empty()){
+            return false;
+        }
+        tile = tiles.front();
+        tiles.pop_front();
+        return true;
+    }
+};
+
+}
 
 /**
  * World::World()
@@ -40,6 +259,17 @@
 World::World(){
     this->width = 0;
     this->height = 0;
+    liveBounds = {0, 0, 0, 0};
+    staleBounds = {0, 0, 0, 0};
+    generation = 0;
+    publisher = nullptr;
+    publishEvery = 1;
+    threads = 1;
+    pinned = false;
+    hugePages = false;
+    dirtyKnown = false;
+    dirtyTopology = Topology::PLANE;
+    looseBounds = false;
 }
 
 /**
@@ -75,6 +305,17 @@ World::World(int square_size){
             nextGrid.set(x,y,Cell::DEAD);
         }
     }
+    liveBounds = {0, 0, 0, 0};
+    staleBounds = {0, 0, 0, 0};
+    generation = 0;
+    publisher = nullptr;
+    publishEvery = 1;
+    threads = 1;
+    pinned = false;
+    hugePages = false;
+    dirtyKnown = false;
+    dirtyTopology = Topology::PLANE;
+    looseBounds = false;
 }
 
 
@@ -107,6 +348,17 @@ World::World(int width, int height){
             nextGrid.set(x,y,Cell::DEAD);
         }
     }
+    liveBounds = {0, 0, 0, 0};
+    staleBounds = {0, 0, 0, 0};
+    generation = 0;
+    publisher = nullptr;
+    publishEvery = 1;
+    threads = 1;
+    pinned = false;
+    hugePages = false;
+    dirtyKnown = false;
+    dirtyTopology = Topology::PLANE;
+    looseBounds = false;
 }
 
 
@@ -143,6 +395,17 @@ World::World(Grid initial_state){
             nextGrid.set(x,y,Cell::DEAD);
         }
     }
+    liveBounds = currentGrid.get_bounding_box();
+    staleBounds = {0, 0, 0, 0};
+    generation = 0;
+    publisher = nullptr;
+    publishEvery = 1;
+    threads = 1;
+    pinned = false;
+    hugePages = false;
+    dirtyKnown = false;
+    dirtyTopology = Topology::PLANE;
+    looseBounds = false;
 }
 
 
@@ -312,6 +575,7 @@ int World::get_dead_cells(){
  * Return a read-only reference to the current state
  * The function should be callable from a constant context.
  * The function should not invoke a copy the current state.
+ * The reference is to the grid the world steps into, so other threads should read a World::snapshot() instead.
  *
  * @example
  *
@@ -335,6 +599,360 @@ const Grid& World::get_state(){
 }
 
 
+/**
+ * World::get_bounding_box()
+ *
+ * Gets the smallest box containing every alive cell in the current state.
+ * The box is kept up to date by each step, so this does not scan the world. After edits or steps that only
+ * recomputed the cells around them, see World::set_cell(x, y, state), only the cells inside the box are scanned.
+ *
+ * @example
+ *
+ *      // Make a world with an r-pentomino in it and run it for a while
+ *      Grid grid(4096);
+ *      grid.merge(Zoo::r_pentomino(), 2048, 2048);
+ *      World world(grid);
+ *      world.advance(100);
+ *
+ *      // Save only the occupied part of the world
+ *      Bounds box = world.get_bounding_box();
+ *      Zoo::save_ascii("path/to/file.gol", world.get_state().crop(box.x0, box.y0, box.x1, box.y1));
+ *
+ * @return
+ *      The bounding box of the alive cells, or an empty Bounds of {0, 0, 0, 0} if no cells are alive.
+ */
+Bounds World::get_bounding_box(){
+    //a box only grown by edits and incremental steps is shrunk back onto the alive cells inside it
+    if(looseBounds){
+        Bounds box = {liveBounds.x1, liveBounds.y1, liveBounds.x0, liveBounds.y0};
+        for(int y = liveBounds.y0; y < liveBounds.y1; y++){
+            const Cell* row = &currentGrid(0, y);
+            for(int x = liveBounds.x0; x < liveBounds.x1; x++){
+                if(row[x] == Cell::ALIVE){
+                    box = {std::min(box.x0, x), std::min(box.y0, y), std::max(box.x1, x + 1), y + 1};
+                }
+            }
+        }
+        liveBounds = (box.x0 < box.x1) ? box : Bounds{0, 0, 0, 0};
+        looseBounds = false;
+    }
+    return liveBounds;
+}
+
+
+/**
+ * World::get_generation()
+ *
+ * Gets the number of steps the world has taken since it was constructed.
+ *
+ * @example
+ *
+ *      // Make a world and step it forward
+ *      World world(16);
+ *      world.advance(10);
+ *
+ *      // Prints 10
+ *      std::cout << world.get_generation() << std::endl;
+ *
+ * @return
+ *      The current generation number.
+ */
+int World::get_generation(){
+    return generation;
+}
+
+
+/**
+ * World::get_rule()
+ *
+ * Gets the rule the world is simulated with.
+ *
+ * @return
+ *      A read-only reference to the rule.
+ */
+const Rule& World::get_rule(){
+    return rule;
+}
+
+
+/**
+ * World::set_rule(new_rule)
+ *
+ * Changes the rule used by every following step. Worlds start with Conway's B3/S23 rule.
+ *
+ * @example
+ *
+ *      // Make a world and simulate it with the HighLife rule
+ *      World world(64);
+ *      world.set_rule(Rule("B36/S23"));
+ *      world.advance(100);
+ *
+ * @param new_rule
+ *      The rule to simulate with.
+ *
+ * @throws
+ *      std::exception or sub-class if the rule is a Generations rule with more than two states,
+ *      which need a GenerationsWorld to hold their dying cells.
+ */
+void World::set_rule(Rule new_rule){
+    //exception
+    if(new_rule.get_states() != 2){
+        throw std::runtime_error("rule has more than two states");
+    }
+    rule = new_rule;
+    dirtyKnown = false;
+}
+
+
+/**
+ * World::set_publisher(new_publisher, every)
+ *
+ * Publishes the world's frames to other processes as it is stepped, through a shared memory ring that any number
+ * of viewers can read with a FrameReader. The world does not own the publisher, which must outlive it or be
+ * removed first. Resizing the world to a size other than the publisher's frames detaches it.
+ *
+ * @example
+ *
+ *      // Make a world and publish every 10th generation for viewers of "/life_frames"
+ *      World world(1000);
+ *      FramePublisher publisher("/life_frames", world.get_width(), world.get_height());
+ *      world.set_publisher(&publisher, 10);
+ *      world.advance(1000);
+ *
+ * @param new_publisher
+ *      The publisher to hand frames to, or nullptr to stop publishing.
+ *
+ * @param every
+ *      Optional parameter. Publish the generations that are a multiple of this. Defaults to 1, every generation.
+ *
+ * @throws
+ *      std::exception or sub-class if every is not positive, or the publisher's frames are not the size of the
+ *      world.
+ */
+void World::set_publisher(FramePublisher* new_publisher, int every){
+    //exception
+    if(every < 1){
+        throw std::runtime_error("must publish every 1 or more generations");
+    }
+    //exception
+    if(new_publisher != nullptr &&
+       (new_publisher->get_width() != get_width() || new_publisher->get_height() != get_height())){
+        throw std::runtime_error("publisher's frames are not the size of the world");
+    }
+    publisher = new_publisher;
+    publishEvery = every;
+}
+
+
+/**
+ * World::enable_snapshots()
+ *
+ * Lets other threads read the world while it is being stepped. From now on the world publishes a copy of each
+ * generation it finishes, starting with the current one, and any thread can take a WorldSnapshot of the latest with
+ * World::snapshot(). Neither the world nor the readers ever wait for each other. Call this before handing the world
+ * to other threads; calling it again does nothing.
+ *
+ * @example
+ *
+ *      // Step a world on one thread and check on it from another
+ *      World world(1000);
+ *      world.enable_snapshots();
+ *      std::thread stepping([&](){ world.advance(10000); });
+ *      WorldSnapshot latest = world.snapshot();
+ *      std::cout << latest.get_generation() << std::endl << latest.get_state() << std::endl;
+ *      stepping.join();
+ */
+void World::enable_snapshots(){
+    if(snapshots.store == nullptr){
+        snapshots.store = std::make_shared<SnapshotStore>();
+        publish_snapshot();
+    }
+}
+
+/**
+ * World::snapshot()
+ *
+ * Take a snapshot of the last generation the world finished, which stays unchanged however far the world is stepped
+ * while it is held. Safe to call from any thread while another steps the world, unlike World::get_state().
+ * Edits made with World::set_cell(x, y, state) or World::set_cells(cells, x0, y0) since the last step are not in it;
+ * they show from the next step on, so a burst of edits costs one copy of the world rather than one per edit.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The snapshot.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if snapshots have not been enabled with World::enable_snapshots().
+ */
+WorldSnapshot World::snapshot() const{
+    //exception
+    if(snapshots.store == nullptr){
+        throw std::runtime_error("snapshots are not enabled");
+    }
+    return WorldSnapshot(snapshots.store);
+}
+
+/**
+ * World::publish_snapshot()
+ *
+ * Private helper function to publish the current state for snapshots, if they are enabled.
+ */
+void World::publish_snapshot(){
+    if(snapshots.store != nullptr){
+        snapshots.store->publish(currentGrid, liveBounds, generation);
+    }
+}
+
+
+/**
+ * World::set_cell(x, y, state)
+ *
+ * Change one cell of the current state, such as when a user draws on the world between steps. The edit is recorded
+ * as dirty, so if little else is changing the next step only recomputes the cells around it and the cells that
+ * changed in the last step, rather than the whole world, see World::step(topology). Snapshots see the edit once the
+ * next step is published, rather than the world being copied for every edit.
+ *
+ * @example
+ *
+ *      // Drop a cell next to a block on a big board and watch it settle
+ *      World world(Zoo::load_ascii("still_lifes.gol"));
+ *      world.step();
+ *      world.set_cell(100, 100, Cell::ALIVE);
+ *      world.advance(10);
+ *
+ * @param x
+ *      The x coordinate of the cell.
+ *
+ * @param y
+ *      The y coordinate of the cell.
+ *
+ * @param state
+ *      The new state of the cell.
+ *
+ * @throws
+ *      std::exception or sub-class if x,y is not a valid coordinate within the world.
+ */
+void World::set_cell(int x, int y, Cell state){
+    //exception
+    if(x < 0 || x >= get_width() || y < 0 || y >= get_height()){
+        throw std::runtime_error("not within bounds");
+    }
+    currentGrid(x, y) = state;
+    Bounds cell = {x, y, x + 1, y + 1};
+    if(state == Cell::ALIVE){
+        liveBounds = merge_bounds(liveBounds, cell);
+    }else{
+        looseBounds = true;
+    }
+    mark_dirty(cell);
+}
+
+/**
+ * World::set_cells(cells, x0, y0)
+ *
+ * Copies a grid of cells into the current state with its top left corner at x0, y0, recording the area as dirty
+ * as World::set_cell(x, y, state) does. Cells of the grid that fall outside the world are left out.
+ *
+ * @example
+ *
+ *      // Paste a glider into a running world
+ *      world.set_cells(Zoo::glider(), 10, 10);
+ *
+ * @param cells
+ *      The cells to copy in, dead cells included.
+ *
+ * @param x0
+ *      The x coordinate to put the grid's left edge at.
+ *
+ * @param y0
+ *      The y coordinate to put the grid's top edge at.
+ */
+void World::set_cells(const Grid& cells, int x0, int y0){
+    Bounds area = clip_bounds({x0, y0, x0 + cells.get_width(), y0 + cells.get_height()},
+                              {0, 0, get_width(), get_height()});
+    if(area.x0 >= area.x1){
+        return;
+    }
+
+    //loop that copies each row of the pasted part
+    for(int y = area.y0; y < area.y1; y++){
+        const Cell* row = &cells(area.x0 - x0, y - y0);
+        std::copy(row, row + (area.x1 - area.x0), &currentGrid(area.x0, y));
+    }
+    liveBounds = merge_bounds(liveBounds, area);
+    looseBounds = true;
+    mark_dirty(area);
+}
+
+/**
+ * World::mark_dirty(box)
+ *
+ * Private helper function to record an edited area as dirty, for the next step to recompute around.
+ *
+ * @param box
+ *      The edited area.
+ */
+void World::mark_dirty(Bounds box){
+    if(dirtyKnown){
+        add_dirty(grow_bounds(box, 1, get_width(), get_height()));
+    }
+    tileAlive.clear();
+}
+
+/**
+ * World::add_dirty(area)
+ *
+ * Private helper function to add an area to the cells the next step recomputes, split between the tiles it
+ * overlaps. Each tile keeps the smallest box covering the parts of the areas added to it, and the tiles with any
+ * are listed in the order they were first added to.
+ *
+ * @param area
+ *      The cells to recompute, which may be empty.
+ */
+void World::add_dirty(Bounds area){
+    if(area.x0 >= area.x1 || area.y0 >= area.y1){
+        return;
+    }
+    int tilesX = (get_width() + TILE - 1) / TILE;
+
+    //nested loops that merge the part of the area in each tile it overlaps into that tile's box
+    for(int ty = area.y0 / TILE; ty <= (area.y1 - 1) / TILE; ty++){
+        for(int tx = area.x0 / TILE; tx <= (area.x1 - 1) / TILE; tx++){
+            int tile = (ty * tilesX) + tx;
+            Bounds& part = tileDirty[std::size_t(tile)];
+            if(part.x0 >= part.x1){
+                dirtyTiles.push_back(tile);
+            }
+            part = merge_bounds(part, clip_bounds(area, {tx * TILE, ty * TILE, (tx + 1) * TILE, (ty + 1) * TILE}));
+        }
+    }
+}
+
+/**
+ * World::set_dirty(changed)
+ *
+ * Private helper function to make the cells within one cell of where a step changed cells the ones the next step
+ * recomputes, forgetting those of the step before. Only the tiles that were dirty are cleared, so the cost is in
+ * the number of changes rather than the size of the world.
+ *
+ * @param changed
+ *      Boxes covering every cell the step changed, any of which may be empty.
+ */
+void World::set_dirty(const std::vector<Bounds>& changed){
+    std::size_t count = std::size_t((get_width() + TILE - 1) / TILE) * ((get_height() + TILE - 1) / TILE);
+    if(tileDirty.size() != count){
+        tileDirty.assign(count, Bounds{0, 0, 0, 0});
+    }else{
+        for(int tile : dirtyTiles){
+            tileDirty[std::size_t(tile)] = {0, 0, 0, 0};
+        }
+    }
+    dirtyTiles.clear();
+    for(const Bounds& box : changed){
+        add_dirty(grow_bounds(box, 1, get_width(), get_height()));
+    }
+}
+
 /**
  * World::resize(square_size)
  *
@@ -355,9 +973,7 @@ const Grid& World::get_state(){
  *      The new edge size for both the width and height of the grid.
  */
 void World::resize(int square_size){
-    this->width = square_size;
-    this->height = square_size;
-    currentGrid.resize(square_size, square_size);
+    resize(square_size, square_size);
 }
 
 /**
@@ -367,6 +983,7 @@ void World::resize(int square_size){
  *
  * The content of the current state grid should be preserved within the kept region.
  * The values in the next state grid do not need to be preserved, allowing an easy optimization.
+ * A publisher whose frames are not the new size is detached, see World::set_publisher().
  *
  * @example
  *
@@ -386,96 +1003,676 @@ void World::resize(int new_width, int new_height){
     this->width = new_width;
     this->height = new_height;
     currentGrid.resize(new_width, new_height);
+
+    //a publisher's frames can't change size, so one for the old size is detached rather than failing the next step
+    if(publisher != nullptr && (publisher->get_width() != new_width || publisher->get_height() != new_height)){
+        publisher = nullptr;
+    }
+
+    //the next state is rebuilt empty rather than resized, so nothing stale is left in it
+    nextGrid = Grid(new_width, new_height);
+    liveBounds = currentGrid.get_bounding_box();
+    staleBounds = {0, 0, 0, 0};
+    tileAlive.clear();
+    dirtyKnown = false;
+    looseBounds = false;
+    if(threads > 1){
+        place_grids();
+    }
+    publish_snapshot();
 }
 
 
 /**
- * World::count_neighbours(x, y, toroidal)
+ * World::fill_halos(topology)
  *
- * Private helper function to count the number of alive neighbours of a cell.
- * The function should not be visible from outside the World class.
+ * Private helper function to work out the ring of cells just beyond the edges of the world for a topology.
  *
- * Neighbours are considered within the 3x3 square centred around the cell at x,y in the current state grid.
- * Ignore the centre coordinate, a cell is not its own neighbour.
- * Attempt to keep the logic as simple, expressive, and readable as possible.
+ * The halo rows above and below the world run from x = -1 to x = width, so they include the corners. The halo
+ * columns to the left and right run from y = 0 to y = height - 1. Each halo cell is found by crossing the edges
+ * it is beyond one at a time, left or right first, then top or bottom. Crossing a joined edge wraps the coordinate
+ * to the opposite side, mirrored if the topology twists that edge. Crossing an edge that is not joined gives the
+ * boundary state, alive for Topology::BOUNDARY_ALIVE and dead otherwise.
  *
- * If toroidal = false then skip any neighbours that would be outside of the grid,
- * this assumes the grid is Cell::DEAD outside its bounds.
+ * The halos are filled once per step, so the kernel never has to check where the edges are.
  *
- * If toroidal = true then correctly wrap out of bounds coordinates to the opposite side of the grid.
- *
- * This function is in World and not Grid because the 3x3 sized neighbourhood is specific to Conway's Game of Life,
- * while Grid is more generic to any 2D grid based cellular automaton.
+ * @param topology
+ *      How the edges of the world are joined.
+ */
+void World::fill_halos(Topology topology){
+    bool joinX = topology == Topology::TORUS || topology == Topology::CYLINDER_HORIZONTAL ||
+                 topology == Topology::KLEIN_BOTTLE || topology == Topology::CROSS_SURFACE;
+    bool joinY = topology == Topology::TORUS || topology == Topology::CYLINDER_VERTICAL ||
+                 topology == Topology::KLEIN_BOTTLE || topology == Topology::CROSS_SURFACE;
+    bool twistX = topology == Topology::CROSS_SURFACE;
+    bool twistY = topology == Topology::KLEIN_BOTTLE || topology == Topology::CROSS_SURFACE;
+    std::uint8_t boundary = (topology == Topology::BOUNDARY_ALIVE);
+
+    //gets the state of a cell up to one cell outside the world
+    auto halo = [&](int x, int y) -> std::uint8_t {
+        if(x < 0 || x >= get_width()){
+            if(!joinX){
+                return boundary;
+            }
+            x = (x + get_width()) % get_width();
+            y = twistX ? (get_height() - 1 - y) : y;
+        }
+        if(y < 0 || y >= get_height()){
+            if(!joinY){
+                return boundary;
+            }
+            y = (y + get_height()) % get_height();
+            x = twistY ? (get_width() - 1 - x) : x;
+        }
+        return currentGrid(x, y) == Cell::ALIVE;
+    };
+
+    haloRows[0].resize(get_width() + 2);
+    haloRows[1].resize(get_width() + 2);
+    for(int x = -1; x <= get_width(); x++){
+        haloRows[0][x + 1] = halo(x, -1);
+        haloRows[1][x + 1] = halo(x, get_height());
+    }
+    haloColumns[0].resize(get_height());
+    haloColumns[1].resize(get_height());
+    for(int y = 0; y < get_height(); y++){
+        haloColumns[0][y] = halo(-1, y);
+        haloColumns[1][y] = halo(get_width(), y);
+    }
+}
+
+/**
+ * World::load_row(y, x0, x1, row)
  *
- * @param x
- *      The x coordinate of the centre of the neighbourhood.
+ * Private helper function to read a row of cells from x0 - 1 to x1 into bytes, 1 for alive and 0 for dead.
+ * Cells beyond the edges of the world are read from the halos written by World::fill_halos(topology).
  *
  * @param y
- *      The y coordinate of the centre of the neighbourhood.
+ *      The y coordinate of the row, from -1 to the height of the world.
  *
- * @param toroidal
- *      If true then the step will consider the grid as a torus, where the left edge
- *      wraps to the right edge and the top to the bottom.
+ * @param x0
+ *      The first column of the window, the cell before it is read too.
  *
- * @return
- *      Returns the number of alive neighbours.
- */
-int World::count_neighbours(int x, int y, bool toroidal){
-    int counter = 0;
-
-    //nested loop that goes through all neighbour cell and the cell at (x,y)
-    for(int j = y-1; j <= y+1; j++){
-        for(int i = x-1; i <= x+1; i++){
-            //conditional to do nothing when at cell (x,y)
-            if(i==x && j==y){}
-            else{
-                if(toroidal){
-                    /*conditional that checks what value of cell should be when out of
-                    bounds brfore counting the neighbour if alive*/
-                    if(i >= get_width() || j >= get_height() || i<0 || j<0){
-
-                        int a = i;
-                        int b = j;
-                        if(i < 0){
-                            a = get_width() + i;
-                        }
-                        else if(i >= get_width()){
-                            a = i-get_width();
-                        }
-                        if(j < 0){
-                            b = get_height() + j;
-                        }
-                        else if(j >= get_height()){
-                            b = j-get_height();
-                        }
-
-                        if(currentGrid.get(a,b) == Cell::ALIVE){counter++;}
-                    }
-                    else if(currentGrid.get(i,j) == Cell::ALIVE){
-                        counter++;
-                    }
-                }else{
-                    //conditional that checks if value of cell out of bounds
-                    if(i >= get_width() || j >= get_height() || i<0 || j<0){}
-                    else if(currentGrid.get(i,j) == Cell::ALIVE){
-                        counter++;
-                    }
-                }
-            }
-        }
+ * @param x1
+ *      The column after the window, which is read too.
+ *
+ * @param row
+ *      Pointer to at least (x1 - x0 + 2) bytes to write the cells into.
+ */
+void World::load_row(int y, int x0, int x1, std::uint8_t* row){
+    //rows beyond the top and bottom come straight from the halo rows
+    if(y < 0 || y >= get_height()){
+        const std::vector<std::uint8_t>& halo = haloRows[y < 0 ? 0 : 1];
+        std::copy(halo.begin() + x0, halo.begin() + x1 + 2, row);
+        return;
+    }
+
+    const Cell* cells = &currentGrid(0, y);
+    row[0] = (x0 > 0) ? (cells[x0 - 1] == Cell::ALIVE) : haloColumns[0][y];
+    for(int x = x0; x < x1; x++){
+        row[x - x0 + 1] = (cells[x] == Cell::ALIVE);
     }
-    return counter;
+    row[x1 - x0 + 1] = (x1 < get_width()) ? (cells[x1] == Cell::ALIVE) : haloColumns[1][y];
 }
 
 /**
- * World::step(toroidal)
+ * World::get_step_region(topology)
  *
- * Take one step in Conway's Game of Life.
+ * Private helper function to find the area of the world that needs to be recomputed in the next step.
  *
- * Reads from the current state grid and writes to the next state grid. Then swaps the grids.
- * Should be implemented by invoking World::count_neighbours(x, y, toroidal).
- * Swapping the grids should be done in O(1) constant time, and should not invoke a copy.
- * Try and boil the logic down to the fewest and most simple conditional statements.
+ * Only cells within one cell of an alive cell can be alive after the step, so the region is the
+ * live bounding box grown by one. The next state grid may still hold alive cells from the previous
+ * generation, so the region also covers their box to overwrite them with the new state.
+ *
+ * If the topology joins edges and the grown box reaches an edge of the world then births can wrap around
+ * to the opposite edge, so the whole world is used instead. The same goes for rules where a dead
+ * cell with no neighbours is born, as then any cell can come alive, and for an alive boundary, as then
+ * any cell along the edges can come alive.
+ *
+ * @param topology
+ *      How the edges of the world are joined.
+ *
+ * @return
+ *      The window of cells that the next step has to compute.
+ */
+Bounds World::get_step_region(Topology topology){
+    Bounds region = grow_bounds(liveBounds, 1, get_width(), get_height());
+
+    //conditional that checks if the grown box is touching an edge it could wrap across
+    if(topology != Topology::PLANE && region.x1 > region.x0 &&
+        (region.x0 == 0 || region.y0 == 0 || region.x1 == get_width() || region.y1 == get_height())){
+        region = {0, 0, get_width(), get_height()};
+    }
+    if(rule.get_transition(Cell::DEAD, 0) == Cell::ALIVE || topology == Topology::BOUNDARY_ALIVE){
+        region = {0, 0, get_width(), get_height()};
+    }
+    return merge_bounds(region, staleBounds);
+}
+
+/**
+ * World::step_region<Standard>(region, buffers, to, load, changed)
+ *
+ * Private helper function to write the next state of every cell in a region to a grid.
+ *
+ * The rows above, on and below each row of the region are kept in three rolling buffers filled by
+ * load(y, x0, x1, row), which reads the current state like World::load_row(y, x0, x1, row), so each row is
+ * read from the grid once and the neighbour counts are plain sums with no checks for the edges of the world.
+ *
+ * When Standard = true the rule of Conway's Game of Life is written directly into the code so the
+ * compiler can specialise it. Otherwise the world's rule is expanded into a lookup table indexed by
+ * the cell state and its neighbour count before the loop starts.
+ *
+ * @param region
+ *      The window of cells to compute.
+ *
+ * @param buffers
+ *      The three rolling row buffers to use, so threads stepping different rows each use their own.
+ *
+ * @param to
+ *      The grid to write the next state into, usually the next state grid.
+ *
+ * @param load
+ *      Reads a row of the current state into bytes, with the same parameters as World::load_row(y, x0, x1, row).
+ *
+ * @param changed
+ *      Set to the bounding box of the cells whose state differs from the current state, found as they are written.
+ *
+ * @return
+ *      The bounding box of the alive cells written to the grid.
+ */
+template <bool Standard, typename Load>
+Bounds World::step_region(Bounds region, std::vector<std::uint8_t>* buffers, Grid& to, const Load& load,
+                          Bounds& changed){
+    Bounds box = {get_width(), get_height(), 0, 0};
+    changed = box;
+
+    //table of the next state for a dead (first 9) or alive (last 9) cell with 0 to 8 neighbours
+    Cell table[18];
+    for(int n = 0; n <= 8; n++){
+        table[n] = rule.get_transition(Cell::DEAD, n);
+        table[9 + n] = rule.get_transition(Cell::ALIVE, n);
+    }
+
+    int span = region.x1 - region.x0;
+    for(int r = 0; r < 3; r++){
+        buffers[r].resize(span + 2);
+    }
+    std::uint8_t* above = buffers[0].data();
+    std::uint8_t* centre = buffers[1].data();
+    std::uint8_t* below = buffers[2].data();
+    load(region.y0 - 1, region.x0, region.x1, above);
+    load(region.y0, region.x0, region.x1, centre);
+
+    /*nested loop to check every cell in the region and analyse whether cell will
+    be dead or alive in the next step*/
+    for(int y = region.y0; y < region.y1; y++){
+        load(y + 1, region.x0, region.x1, below);
+        Cell* next = &to(0, y) + region.x0;
+        int first = span;
+        int last = -1;
+        int firstChanged = span;
+        int lastChanged = -1;
+        for(int i = 0; i < span; i++){
+            int aliveNeighbours = above[i] + above[i + 1] + above[i + 2] +
+                                  centre[i] +               centre[i + 2] +
+                                  below[i] + below[i + 1] + below[i + 2];
+            bool alive = centre[i + 1];
+            if(Standard){
+                next[i] = (aliveNeighbours == 3 || (aliveNeighbours == 2 && alive)) ? Cell::ALIVE : Cell::DEAD;
+            }else{
+                next[i] = table[(alive ? 9 : 0) + aliveNeighbours];
+            }
+
+            //track the first and last alive cell in the row, and the first and last cell that changed
+            if(next[i] == Cell::ALIVE){
+                first = std::min(first, i);
+                last = i;
+            }
+            if((next[i] == Cell::ALIVE) != alive){
+                firstChanged = std::min(firstChanged, i);
+                lastChanged = i;
+            }
+        }
+
+        //grow the new bounding box and the box of changes around the row
+        if(last >= 0){
+            box.x0 = std::min(box.x0, region.x0 + first);
+            box.y0 = std::min(box.y0, y);
+            box.x1 = std::max(box.x1, region.x0 + last + 1);
+            box.y1 = std::max(box.y1, y + 1);
+        }
+        if(lastChanged >= 0){
+            changed.x0 = std::min(changed.x0, region.x0 + firstChanged);
+            changed.y0 = std::min(changed.y0, y);
+            changed.x1 = std::max(changed.x1, region.x0 + lastChanged + 1);
+            changed.y1 = std::max(changed.y1, y + 1);
+        }
+        std::swap(above, centre);
+        std::swap(centre, below);
+    }
+    if(box.x0 >= box.x1){
+        box = {0, 0, 0, 0};
+    }
+    if(changed.x0 >= changed.x1){
+        changed = {0, 0, 0, 0};
+    }
+    return box;
+}
+
+/**
+ * World::step_region_isotropic(region, buffers, to, load, changed)
+ *
+ * Private helper function to write the next state of every cell in a region to a grid,
+ * for rules that depend on the arrangement of the neighbours as well as how many are alive.
+ *
+ * Each row is stepped by step_row(above, centre, below, count, transitions, write) in rule.h, which looks each
+ * cell up in the rule's 512 entry table by the index of its 3x3 neighbourhood, see Rule::get_transitions().
+ * Moving along a row the index is built incrementally, the columns already in it shift one place left and only
+ * the new right hand column is read from the rolling row buffers, as in
+ * World::step_region<Standard>(region, buffers, to, load, changed).
+ *
+ * @param region
+ *      The window of cells to compute.
+ *
+ * @param buffers
+ *      The three rolling row buffers to use.
+ *
+ * @param to
+ *      The grid to write the next state into.
+ *
+ * @param load
+ *      Reads a row of the current state into bytes.
+ *
+ * @param changed
+ *      Set to the bounding box of the cells whose state differs from the current state.
+ *
+ * @return
+ *      The bounding box of the alive cells written to the grid.
+ */
+template <typename Load>
+Bounds World::step_region_isotropic(Bounds region, std::vector<std::uint8_t>* buffers, Grid& to, const Load& load,
+                                    Bounds& changed){
+    Bounds box = {get_width(), get_height(), 0, 0};
+    changed = box;
+
+    const std::array<std::uint8_t, 512>& transitions = rule.get_transitions();
+    int span = region.x1 - region.x0;
+    for(int r = 0; r < 3; r++){
+        buffers[r].resize(span + 2);
+    }
+    std::uint8_t* above = buffers[0].data();
+    std::uint8_t* centre = buffers[1].data();
+    std::uint8_t* below = buffers[2].data();
+    load(region.y0 - 1, region.x0, region.x1, above);
+    load(region.y0, region.x0, region.x1, centre);
+
+    //nested loop that slides a neighbourhood index along each row of the region
+    for(int y = region.y0; y < region.y1; y++){
+        load(y + 1, region.x0, region.x1, below);
+        Cell* next = &to(0, y) + region.x0;
+        int first = span;
+        int last = -1;
+        int firstChanged = span;
+        int lastChanged = -1;
+
+        step_row(above, centre, below, span, transitions, [&](int i, std::uint8_t state){
+            next[i] = state ? Cell::ALIVE : Cell::DEAD;
+
+            //track the first and last alive cell in the row, and the first and last cell that changed
+            if(state){
+                first = std::min(first, i);
+                last = i;
+            }
+            if(state != centre[i + 1]){
+                firstChanged = std::min(firstChanged, i);
+                lastChanged = i;
+            }
+        });
+
+        //grow the new bounding box and the box of changes around the row
+        if(last >= 0){
+            box.x0 = std::min(box.x0, region.x0 + first);
+            box.y0 = std::min(box.y0, y);
+            box.x1 = std::max(box.x1, region.x0 + last + 1);
+            box.y1 = std::max(box.y1, y + 1);
+        }
+        if(lastChanged >= 0){
+            changed.x0 = std::min(changed.x0, region.x0 + firstChanged);
+            changed.y0 = std::min(changed.y0, y);
+            changed.x1 = std::max(changed.x1, region.x0 + lastChanged + 1);
+            changed.y1 = std::max(changed.y1, y + 1);
+        }
+        std::swap(above, centre);
+        std::swap(centre, below);
+    }
+    if(box.x0 >= box.x1){
+        box = {0, 0, 0, 0};
+    }
+    if(changed.x0 >= changed.x1){
+        changed = {0, 0, 0, 0};
+    }
+    return box;
+}
+
+/**
+ * World::step_rows(region, buffers, to, load, changed)
+ *
+ * Private helper function to step a region with the kernel that suits the world's rule, the specialised
+ * step for Conway's rule, the count table for other totalistic rules and the neighbourhood table otherwise.
+ *
+ * @param region
+ *      The window of cells to compute.
+ *
+ * @param buffers
+ *      The three rolling row buffers to use.
+ *
+ * @param to
+ *      The grid to write the next state into.
+ *
+ * @param load
+ *      Reads a row of the current state into bytes.
+ *
+ * @param changed
+ *      Set to the bounding box of the cells whose state differs from the current state.
+ *
+ * @return
+ *      The bounding box of the alive cells written to the grid.
+ */
+template <typename Load>
+Bounds World::step_rows(Bounds region, std::vector<std::uint8_t>* buffers, Grid& to, const Load& load,
+                        Bounds& changed){
+    if(rule.is_standard()){
+        return step_region<true>(region, buffers, to, load, changed);
+    }
+    if(rule.is_totalistic()){
+        return step_region<false>(region, buffers, to, load, changed);
+    }
+    return step_region_isotropic(region, buffers, to, load, changed);
+}
+
+/**
+ * World::step_rows(region, buffers, changed)
+ *
+ * Private helper function to step a region of the current state into the next state grid, reading the cells beyond
+ * the edges of the world from the halos.
+ *
+ * @param region
+ *      The window of cells to compute.
+ *
+ * @param buffers
+ *      The three rolling row buffers to use.
+ *
+ * @param changed
+ *      Set to the bounding box of the cells the step changed.
+ *
+ * @return
+ *      The bounding box of the alive cells written to the next state grid.
+ */
+Bounds World::step_rows(Bounds region, std::vector<std::uint8_t>* buffers, Bounds& changed){
+    return step_rows(region, buffers, nextGrid, [this](int y, int x0, int x1, std::uint8_t* row){
+        load_row(y, x0, x1, row);
+    }, changed);
+}
+
+/**
+ * World::step_tiles(region, topology, changed)
+ *
+ * Private helper function to step a large region a tile at a time, with all of the world's threads if it has more
+ * than one, see World::step_parts(parts, boxes, changed).
+ *
+ * The region is split into TILE x TILE tiles. Stepping it a tile at a time finds where the step changed cells a
+ * tile at a time too, so the next step can recompute around just those, see World::step_dirty(region, topology,
+ * box, changed).
+ *
+ * Tiles where nothing can change are skipped before they are stepped. The world keeps a flag per tile for whether
+ * it held alive cells in the current and previous generations; a tile with no alive cells in itself or its eight
+ * neighbours in the current generation, and none left over in the next state grid from the previous one, stays
+ * dead. Tiles on the edges of a world whose edges are joined or alive are always stepped, as are all tiles of a
+ * rule where dead cells with no neighbours are born. The flags are rebuilt from scratch, every tile counting as
+ * alive, after any step that doesn't go through here.
+ *
+ * @param region
+ *      The window of cells to compute.
+ *
+ * @param topology
+ *      How the edges of the world are joined.
+ *
+ * @param changed
+ *      Added to with the bounding box of the cells the step changed in each tile.
+ *
+ * @return
+ *      The bounding box of the alive cells written to the next state grid.
+ */
+Bounds World::step_tiles(Bounds region, Topology topology, std::vector<Bounds>& changed){
+    int tilesX = (get_width() + TILE - 1) / TILE;
+    int tilesY = (get_height() + TILE - 1) / TILE;
+    std::size_t count = std::size_t(tilesX) * tilesY;
+    if(tileAlive.size() != count){
+        tileAlive.assign(count, 1);
+        tileStale.assign(count, 1);
+    }
+    bool births = rule.get_transition(Cell::DEAD, 0) == Cell::ALIVE;
+    bool edges = topology != Topology::PLANE;
+
+    //gets whether a tile or any of its neighbours held alive cells in the current generation
+    auto near_alive = [&](int tx, int ty){
+        for(int ny = std::max(0, ty - 1); ny <= std::min(tilesY - 1, ty + 1); ny++){
+            for(int nx = std::max(0, tx - 1); nx <= std::min(tilesX - 1, tx + 1); nx++){
+                if(tileAlive[(std::size_t(ny) * tilesX) + nx]){
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+
+    //nested loops that collect the part of each tile of the region that can change
+    std::vector<Bounds> parts;
+    std::vector<int> tiles;
+    for(int ty = region.y0 / TILE; ty <= (region.y1 - 1) / TILE; ty++){
+        for(int tx = region.x0 / TILE; tx <= (region.x1 - 1) / TILE; tx++){
+            bool edge = tx == 0 || ty == 0 || tx == tilesX - 1 || ty == tilesY - 1;
+            int tile = (ty * tilesX) + tx;
+            if(births || (edges && edge) || tileStale[std::size_t(tile)] || near_alive(tx, ty)){
+                parts.push_back({std::max(region.x0, tx * TILE), std::max(region.y0, ty * TILE),
+                                 std::min(region.x1, (tx + 1) * TILE), std::min(region.y1, (ty + 1) * TILE)});
+                tiles.push_back(tile);
+            }
+        }
+    }
+
+    std::vector<Bounds> boxes;
+    step_parts(parts, boxes, changed);
+
+    //the current generation becomes the stale one left in the next state grid
+    std::vector<std::uint8_t> nextAlive(count, 0);
+    Bounds box = {0, 0, 0, 0};
+    for(std::size_t i = 0; i < parts.size(); i++){
+        nextAlive[std::size_t(tiles[i])] = boxes[i].x0 < boxes[i].x1;
+        box = merge_bounds(box, boxes[i]);
+    }
+    tileStale.swap(tileAlive);
+    tileAlive.swap(nextAlive);
+    return box;
+}
+
+/**
+ * World::step_parts(parts, boxes, changed)
+ *
+ * Private helper function to step a list of parts of the world that don't overlap, sharing them between the
+ * world's threads by stealing. A world with one thread steps them on the calling thread.
+ *
+ * Each part is first given to the thread whose band of rows it starts in, so that when the alive cells are spread
+ * evenly each thread steps the cells it placed in memory. Each thread works through its own deque of parts, and
+ * once that is empty steals parts from the other threads, starting with the next band along, until every deque is
+ * empty. Parts crowded into a few bands are still shared out between every thread. Each part's results are written
+ * only by the thread that stepped it, so none need locking.
+ *
+ * @param parts
+ *      The windows of cells to compute, no two overlapping.
+ *
+ * @param boxes
+ *      Set to the bounding box of the alive cells written to each part.
+ *
+ * @param changed
+ *      Added to with the bounding box of the cells the step changed in each part, in the order of the parts.
+ */
+void World::step_parts(const std::vector<Bounds>& parts, std::vector<Bounds>& boxes, std::vector<Bounds>& changed){
+    std::size_t first = changed.size();
+    boxes.assign(parts.size(), Bounds{0, 0, 0, 0});
+    changed.resize(first + parts.size(), Bounds{0, 0, 0, 0});
+    if(threads <= 1){
+        for(std::size_t i = 0; i < parts.size(); i++){
+            boxes[i] = step_rows(parts[i], rowBuffers, changed[first + i]);
+        }
+        return;
+    }
+
+    //loop that queues each part with the thread whose band it starts in
+    std::vector<TileDeque> deques(threads);
+    for(std::size_t i = 0; i < parts.size(); i++){
+        int band = int((std::int64_t(parts[i].y0) * threads) / get_height());
+        while(band + 1 < threads && (std::int64_t(get_height()) * (band + 1)) / threads <= parts[i].y0){
+            band++;
+        }
+        while(band > 0 && (std::int64_t(get_height()) * band) / threads > parts[i].y0){
+            band--;
+        }
+        deques[band].tiles.push_back(int(i));
+    }
+
+    run_bands([&](int own, int, int){
+        std::vector<std::uint8_t> buffers[3];
+        int part = 0;
+
+        //loop that takes this thread's own parts, then steals from the other threads until no parts are left
+        while(true){
+            bool found = deques[own].pop(part);
+            for(int k = 1; !found && k < threads; k++){
+                found = deques[(own + k) % threads].steal(part);
+            }
+            if(!found){
+                break;
+            }
+            boxes[std::size_t(part)] = step_rows(parts[std::size_t(part)], buffers, changed[first + part]);
+        }
+    });
+}
+
+/**
+ * World::run_bands(work)
+ *
+ * Private helper function to split the rows of the world into one fixed band per thread and run
+ * work(band, y0, y1) on each band on the world's BandPool, whose thread for each band is pinned to the band's cpu
+ * if the world's threads are pinned. The pool is kept from World::set_threads() on, and a copy of the world starts
+ * its own the first time it needs one. Band b always covers the same rows and is always run by the same thread, so
+ * the thread that first wrote a band's cells in World::place_grids() is the one that steps them.
+ *
+ * @param work
+ *      The work to do for each band, given the band's index and its rows [y0, y1).
+ */
+void World::run_bands(const std::function<void(int, int, int)>& work){
+    if(bands.pool == nullptr || bands.pool->get_bands() != threads){
+        bands.pool = std::make_shared<BandPool>(threads, cpus);
+    }
+    int rows = get_height();
+    bands.pool->run([&](int band){
+        int y0 = int((std::int64_t(rows) * band) / threads);
+        int y1 = int((std::int64_t(rows) * (band + 1)) / threads);
+        work(band, y0, y1);
+    });
+}
+
+/**
+ * World::place_grids()
+ *
+ * Private helper function to move the current and next state grids into freshly allocated grids whose cells are
+ * first written by the thread of each row band, see Grid::allocate(width, height). On a NUMA machine each band's
+ * pages then live on the node of the cpu that steps them, rather than all on the node of the thread that made the
+ * world. If huge pages are wanted the new grids are advised to use them before any of their pages are touched.
+ */
+void World::place_grids(){
+    if(get_width() <= 0 || get_height() <= 0){
+        return;
+    }
+    Grid current;
+    Grid next;
+    current.allocate(get_width(), get_height());
+    next.allocate(get_width(), get_height());
+    if(hugePages){
+        advise_huge_pages(&current(0, 0), std::size_t(get_width()) * get_height());
+        advise_huge_pages(&next(0, 0), std::size_t(get_width()) * get_height());
+    }
+
+    run_bands([&](int, int y0, int y1){
+        if(y0 < y1){
+            std::size_t count = std::size_t(get_width()) * (y1 - y0);
+            std::copy_n(&currentGrid(0, y0), count, &current(0, y0));
+            std::copy_n(&nextGrid(0, y0), count, &next(0, y0));
+        }
+    });
+    std::swap(currentGrid, current);
+    std::swap(nextGrid, next);
+}
+
+/**
+ * World::set_threads(new_threads, pin, huge_pages)
+ *
+ * Steps large worlds with several threads, see World::step(topology). The threads are started here and kept for
+ * every step after. Each thread owns a fixed band of rows, and the world's grids are moved into new memory first
+ * written band by band by the threads that own them, so on a machine with several NUMA nodes each band's cells are
+ * local to the cpu that usually steps them. This is redone whenever the world is resized.
+ *
+ * Pinned threads are spread evenly over the NUMA nodes, with consecutive bands on the same node, and use one
+ * hardware thread of each core before doubling up. Pinning is best effort, a thread that cannot be pinned just
+ * runs wherever it is scheduled. Steps whose region is small are taken by the calling thread alone.
+ *
+ * @example
+ *
+ *      // Make a large world and step it on every core, backed by huge pages
+ *      World world(16384);
+ *      world.set_threads(0, true, true);
+ *      world.advance(100);
+ *
+ * @param new_threads
+ *      The number of threads to step with, 1 to step on the calling thread alone or 0 to use every core.
+ *
+ * @param pin
+ *      Optional parameter. Pin each band's thread to its own cpu. Defaults to true.
+ *
+ * @param huge_pages
+ *      Optional parameter. Ask for the grids to be backed by transparent huge pages, which cuts the TLB misses of
+ *      large worlds. Only grids of at least 2 MiB can use them. Defaults to false.
+ *
+ * @throws
+ *      std::exception or sub-class if the number of threads is negative.
+ */
+void World::set_threads(int new_threads, bool pin, bool huge_pages){
+    //exception
+    if(new_threads < 0){
+        throw std::runtime_error("number of threads can't be negative");
+    }
+    if(new_threads == 0){
+        new_threads = std::max(1, int(std::thread::hardware_concurrency()));
+    }
+    threads = new_threads;
+    pinned = pin;
+    hugePages = huge_pages;
+    cpus = pin ? get_cpus(threads) : std::vector<int>();
+
+    //the old threads are pinned for the old bands, so a new pool is started for the new ones
+    bands.pool.reset();
+    if(threads > 1){
+        bands.pool = std::make_shared<BandPool>(threads, cpus);
+        place_grids();
+    }
+}
+
+/**
+ * World::step(toroidal)
+ *
+ * Take one step in Conway's Game of Life, or in the world's rule if it has been changed.
+ * Should be implemented by invoking World::step(topology).
  *
  * Rules: https://en.wikipedia.org/wiki/Conway%27s_Game_of_Life
  *      - Any live cell with fewer than two live neighbours dies, as if by underpopulation.
@@ -488,33 +1685,327 @@ int World::count_neighbours(int x, int y, bool toroidal){
  *      wraps to the right edge and the top to the bottom. Defaults to false.
  */
 void World::step(bool toroidal){
+    step(toroidal ? Topology::TORUS : Topology::PLANE);
+}
 
-    /*nested loop to check every cell in world and analyse whether cell will
-    be dead or alive in the next step*/
-    for(int y = 0; y < get_height(); y++){
-        for(int x = 0; x < get_width(); x++){
-            int aliveNeighbours = count_neighbours(x, y, toroidal);
-            if(aliveNeighbours == 2 || aliveNeighbours == 3){
-                if(currentGrid.get(x,y) == Cell::ALIVE){
-                    nextGrid.set(x,y, ALIVE);
-                }else if(currentGrid.get(x,y) == Cell::DEAD && aliveNeighbours == 3){
-                    nextGrid.set(x,y, ALIVE);
-                }
+/**
+ * World::step(topology)
+ *
+ * Take one step in the world's rule, with the edges of the world joined according to a topology.
+ *
+ * Reads from the current state grid and writes to the next state grid. Then swaps the grids.
+ * Should be implemented by invoking World::step_rows(region, buffers, changed), which picks the kernel for the rule.
+ * Swapping the grids should be done in O(1) constant time, and should not invoke a copy.
+ * Try and boil the logic down to the fewest and most simple conditional statements.
+ *
+ * Only the region found by World::get_step_region(topology) is visited, every cell outside it
+ * is dead in both the current and next state grids. The bounding box of the alive cells is
+ * shrunk back down to fit the new state as the region is written. The halo of cells beyond the
+ * edges is only filled when the region reaches an edge.
+ *
+ * A large region is split into tiles and stepped by World::step_tiles(region, topology, changed). With more than
+ * one thread, see World::set_threads(threads, pin, huge_pages), the threads share out the tiles however unevenly
+ * the alive cells are spread.
+ *
+ * Each step also records where it changed cells, a tile at a time, as the kernels write them. When the tiles around
+ * those changes and any edits since, see World::set_cell(x, y, state), hold fewer cells than the region, only they
+ * are stepped, see World::step_dirty(region, topology, box, changed). A board that has mostly settled then costs
+ * about the same to step however large it is.
+ *
+ * @example
+ *
+ *      // Step a world on a Klein bottle
+ *      World world(Zoo::glider());
+ *      world.step(Topology::KLEIN_BOTTLE);
+ *
+ * @param topology
+ *      How the edges of the world are joined.
+ */
+void World::step(Topology topology){
+    Bounds region = get_step_region(topology);
+    Bounds box = {0, 0, 0, 0};
+    std::vector<Bounds> changed;
+
+    //conditional that only recomputes the tiles around the last changes and edits when that is less work
+    if(!step_dirty(region, topology, box, changed)){
+        if(region.x0 < region.x1 && region.y0 < region.y1){
+            if(region.x0 == 0 || region.y0 == 0 || region.x1 == get_width() || region.y1 == get_height()){
+                fill_halos(topology);
+            }
+
+            //conditional that splits large regions into tiles, shared between the threads if there are several
+            long long cells = static_cast<long long>(region.x1 - region.x0) * (region.y1 - region.y0);
+            if(cells >= PARALLEL_CELLS){
+                box = step_tiles(region, topology, changed);
             }else{
-                nextGrid.set(x,y, DEAD);
+                changed.emplace_back();
+                box = step_rows(region, rowBuffers, changed.back());
+                tileAlive.clear();
             }
         }
+        looseBounds = false;
+    }
+
+    //take the next step, the old state is left in the next grid to be overwritten
+    std::swap(currentGrid, nextGrid);
+    staleBounds = liveBounds;
+    liveBounds = box;
+    generation++;
+    set_dirty(changed);
+    dirtyKnown = true;
+    dirtyTopology = topology;
+
+    //hand every publishEvery'th generation to the publisher, if there is one
+    if(publisher != nullptr && generation % publishEvery == 0){
+        publisher->publish(currentGrid, generation);
     }
-    //take the next step
-    currentGrid = nextGrid;
+    publish_snapshot();
 }
 
+/**
+ * World::step_dirty(region, topology, box, changed)
+ *
+ * Private helper function to step only the dirty tiles, if that is less work than stepping the region
+ * World::get_step_region(topology) gives.
+ *
+ * After every step the next state grid holds the previous generation, and each dirty tile keeps a box covering
+ * the cells of the tile within one cell of a cell that changed between it and the current one, or of a cell
+ * edited since. Any other cell has the same neighbours as in the previous generation, so it steps to the state it
+ * already has, which is also its state in the next state grid. Only the boxes of the dirty tiles need stepping,
+ * however busy the rest of the world is, and the tiles for the next step are found from where those boxes changed.
+ * Changes spread over the whole world are still only recomputed a tile at a time, never merged into one box.
+ *
+ * The boxes are shared between the world's threads when they hold enough cells, see World::step_parts(parts,
+ * boxes, changed), and each reports the cells it changed as it is stepped.
+ *
+ * This only holds if the world was stepped last with the same topology and rule, and with dirty tiles that
+ * don't reach an edge joined to another, as the cells across it would change too.
+ *
+ * @param region
+ *      The region a full step would compute.
+ *
+ * @param topology
+ *      How the edges of the world are joined.
+ *
+ * @param box
+ *      Set to a box covering every alive cell of the next generation, though not always the smallest.
+ *
+ * @param changed
+ *      Filled with boxes covering every cell the step changed.
+ *
+ * @return
+ *      True if the step was taken, or false to take a full step instead.
+ */
+bool World::step_dirty(Bounds region, Topology topology, Bounds& box, std::vector<Bounds>& changed){
+    if(!dirtyKnown || topology != dirtyTopology){
+        return false;
+    }
+    bool joined = topology != Topology::PLANE && topology != Topology::BOUNDARY_ALIVE;
+
+    //the boxes of the dirty tiles, and how many cells they hold
+    std::vector<Bounds> parts;
+    long long cells = 0;
+    bool edge = false;
+    for(int tile : dirtyTiles){
+        const Bounds& part = tileDirty[std::size_t(tile)];
+        bool touches = part.x0 == 0 || part.y0 == 0 || part.x1 == get_width() || part.y1 == get_height();
+        if(touches && joined){
+            return false;
+        }
+        edge = edge || touches;
+        cells += static_cast<long long>(part.x1 - part.x0) * (part.y1 - part.y0);
+        parts.push_back(part);
+    }
+    if(cells >= static_cast<long long>(region.x1 - region.x0) * (region.y1 - region.y0)){
+        return false;
+    }
+    if(edge){
+        fill_halos(topology);
+    }
+
+    //conditional that shares the boxes between the threads when there are enough cells to be worth it
+    std::vector<Bounds> boxes;
+    if(threads > 1 && cells >= PARALLEL_CELLS){
+        step_parts(parts, boxes, changed);
+    }else{
+        changed.resize(parts.size(), Bounds{0, 0, 0, 0});
+        for(std::size_t i = 0; i < parts.size(); i++){
+            boxes.push_back(step_rows(parts[i], rowBuffers, changed[i]));
+        }
+    }
+
+    //every alive cell outside the parts was alive before the step
+    box = liveBounds;
+    for(const Bounds& part : boxes){
+        box = merge_bounds(box, part);
+    }
+    tileAlive.clear();
+    looseBounds = true;
+    return true;
+}
+
+/**
+ * World::can_pipeline(steps, topology)
+ *
+ * Private helper function to decide whether World::advance(steps, topology) should pipeline the generations across
+ * the world's threads, see World::advance_pipelined(steps, topology). The world needs more than one thread, at least
+ * one row per thread and a region big enough for World::step(topology) to share between the threads. The edges
+ * may only be joined straight across, as the twisted joins read rows from the far side of the world, and nothing
+ * may be publishing each generation as the bands never all hold the same one until the end.
+ *
+ * @param steps
+ *      The number of steps to advance.
+ *
+ * @param topology
+ *      How the edges of the world are joined.
+ *
+ * @return
+ *      Whether to pipeline the steps.
+ */
+bool World::can_pipeline(int steps, Topology topology){
+    if(threads <= 1 || steps <= 1 || publisher != nullptr || get_height() < threads){
+        return false;
+    }
+    if(topology == Topology::KLEIN_BOTTLE || topology == Topology::CROSS_SURFACE){
+        return false;
+    }
+    Bounds region = get_step_region(topology);
+    return static_cast<long long>(region.x1 - region.x0) * (region.y1 - region.y0) >= PARALLEL_CELLS;
+}
+
+/**
+ * World::advance_pipelined(steps, topology)
+ *
+ * Private helper function to advance many steps with each thread stepping its own band of rows, see
+ * World::run_bands(work), through every generation without waiting for the others at the end of each step.
+ *
+ * Generation t lives in the current state grid when t is even and the next state grid when it is odd, counting from
+ * the generation the world was at. Each band has a progress counter of the generations it has finished. A band can
+ * step generation t + 1 as soon as the bands above and below it have finished generation t, as the rows either
+ * side of it are then written. That is also the point where they have finished reading its generation t - 1, which
+ * it is about to overwrite. Neighbouring bands are never more than one generation apart, but bands further apart
+ * run freely, so a wave of generations passes down the world rather than every thread stopping at a barrier.
+ *
+ * Each band keeps the bounding box of its alive cells for its last two generations, so only the part of a band
+ * that its own and its neighbours' alive cells can reach is stepped, as in World::get_step_region(topology). The
+ * cells beyond the edges of the world are read straight from the other side of the world, or from the boundary,
+ * instead of from the halos, which would need the whole world at one generation.
+ *
+ * @param steps
+ *      The number of steps to advance.
+ *
+ * @param topology
+ *      How the edges of the world are joined, anything but the twisted joins.
+ */
+void World::advance_pipelined(int steps, Topology topology){
+    int width = get_width();
+    int height = get_height();
+    bool joinX = topology == Topology::TORUS || topology == Topology::CYLINDER_HORIZONTAL;
+    bool joinY = topology == Topology::TORUS || topology == Topology::CYLINDER_VERTICAL;
+    std::uint8_t boundary = (topology == Topology::BOUNDARY_ALIVE) ? 1 : 0;
+    bool whole = rule.get_transition(Cell::DEAD, 0) == Cell::ALIVE || topology == Topology::BOUNDARY_ALIVE;
+    Grid* grids[2] = {&currentGrid, &nextGrid};
+
+    //the boxes of each band's alive cells in its last two generations, and the generations each band has finished
+    std::vector<Bounds> boxes[2];
+    std::vector<std::atomic<long long>> progress(threads);
+    for(int band = 0; band < threads; band++){
+        int y0 = int((std::int64_t(height) * band) / threads);
+        int y1 = int((std::int64_t(height) * (band + 1)) / threads);
+        Bounds rows = {0, y0, width, y1};
+        boxes[0].push_back(clip_bounds(liveBounds, rows));
+        boxes[1].push_back(clip_bounds(staleBounds, rows));
+        progress[std::size_t(band)].store(0);
+    }
+
+    run_bands([&](int band, int y0, int y1){
+        std::vector<std::uint8_t> buffers[3];
+        Bounds rows = {0, y0, width, y1};
+
+        //the bands whose rows border this band's, if any
+        int neighbours[2] = {band - 1, band + 1};
+        for(int& neighbour : neighbours){
+            if(neighbour < 0 || neighbour >= threads){
+                neighbour = joinY ? (neighbour + threads) % threads : -1;
+            }
+        }
+
+        for(long long t = 0; t < steps; t++){
+            const Grid& from = *grids[t % 2];
+            Grid& to = *grids[(t + 1) % 2];
+
+            //wait for the neighbouring bands to finish generation t
+            for(int neighbour : neighbours){
+                while(neighbour >= 0 && progress[std::size_t(neighbour)].load(std::memory_order_acquire) < t){
+                    std::this_thread::yield();
+                }
+            }
+
+            //the part of the band the alive cells of this band and its neighbours can reach
+            Bounds reach = grow_bounds(boxes[t % 2][std::size_t(band)], 1, width, height);
+            for(int neighbour : neighbours){
+                if(neighbour >= 0){
+                    reach = merge_bounds(reach, grow_bounds(boxes[t % 2][std::size_t(neighbour)], 1, width, height));
+                }
+            }
+            bool wraps = topology != Topology::PLANE && reach.x0 < reach.x1 &&
+                         (reach.x0 == 0 || reach.y0 == 0 || reach.x1 == width || reach.y1 == height);
+            Bounds region = (whole || wraps) ? rows : clip_bounds(reach, rows);
+            region = merge_bounds(region, boxes[(t + 1) % 2][std::size_t(band)]);
+
+            //reads a row of generation t, wrapping across the joined edges
+            auto load = [&](int y, int x0, int x1, std::uint8_t* row){
+                if(y < 0 || y >= height){
+                    if(!joinY){
+                        std::fill(row, row + (x1 - x0 + 2), boundary);
+                        return;
+                    }
+                    y = (y + height) % height;
+                }
+                const Cell* cells = &from(0, y);
+                std::uint8_t left = joinX ? (cells[width - 1] == Cell::ALIVE) : boundary;
+                std::uint8_t right = joinX ? (cells[0] == Cell::ALIVE) : boundary;
+                row[0] = (x0 > 0) ? (cells[x0 - 1] == Cell::ALIVE) : left;
+                for(int x = x0; x < x1; x++){
+                    row[x - x0 + 1] = (cells[x] == Cell::ALIVE);
+                }
+                row[x1 - x0 + 1] = (x1 < width) ? (cells[x1] == Cell::ALIVE) : right;
+            };
+
+            Bounds box = {0, 0, 0, 0};
+            Bounds changed = {0, 0, 0, 0};
+            if(region.x0 < region.x1 && region.y0 < region.y1){
+                box = step_rows(region, buffers, to, load, changed);
+            }
+            boxes[(t + 1) % 2][std::size_t(band)] = box;
+            progress[std::size_t(band)].store(t + 1, std::memory_order_release);
+        }
+    });
+
+    //the last generation ends up in the current state grid and the one before it in the next
+    if(steps % 2 == 1){
+        std::swap(currentGrid, nextGrid);
+    }
+    liveBounds = {0, 0, 0, 0};
+    staleBounds = {0, 0, 0, 0};
+    for(int band = 0; band < threads; band++){
+        liveBounds = merge_bounds(liveBounds, boxes[steps % 2][std::size_t(band)]);
+        staleBounds = merge_bounds(staleBounds, boxes[(steps + 1) % 2][std::size_t(band)]);
+    }
+    generation += steps;
+    tileAlive.clear();
+    set_dirty({merge_bounds(liveBounds, staleBounds)});
+    dirtyKnown = true;
+    dirtyTopology = topology;
+    looseBounds = false;
+    publish_snapshot();
+}
 
 /**
  * World::advance(steps, toroidal)
  *
  * Advance multiple steps in the Game of Life.
- * Should be implemented by invoking World::step(toroidal).
+ * Should be implemented by invoking World::advance(steps, topology).
  *
  * @param steps
  *      The number of steps to advance the world forward.
@@ -524,8 +2015,176 @@ void World::step(bool toroidal){
  *      wraps to the right edge and the top to the bottom. Defaults to false.
  */
 void World::advance(int steps, bool toroidal){
+    advance(steps, toroidal ? Topology::TORUS : Topology::PLANE);
+}
+
+/**
+ * World::advance(steps, topology)
+ *
+ * Advance multiple steps in the world's rule, with the edges of the world joined according to a topology.
+ * Should be implemented by invoking World::step(topology), unless the world is big enough and has the threads to
+ * pipeline the steps, see World::advance_pipelined(steps, topology), which gives the same result.
+ *
+ * @param steps
+ *      The number of steps to advance the world forward.
+ *
+ * @param topology
+ *      How the edges of the world are joined.
+ */
+void World::advance(int steps, Topology topology){
+    //conditional that hands large worlds on many threads to the pipelined advance
+    if(can_pipeline(steps, topology)){
+        advance_pipelined(steps, topology);
+        return;
+    }
+
     //change world the number of steps
     for(int i = 0; i < steps; i++){
-        step(toroidal);
+        step(topology);
+    }
+}
+
+
+/**
+ * World::state_hash()
+ *
+ * Private helper function to hash the current state into 64 bits.
+ *
+ * Every cell outside the live bounding box is dead, so only the cells inside the box are hashed,
+ * along with where the box is so that a moved pattern does not look like the same state.
+ *
+ * @return
+ *      Returns the hash of the current state grid.
+ */
+std::uint64_t World::state_hash(){
+    Bounds box = get_bounding_box();
+    std::uint64_t position = (std::uint64_t(box.x0) << 32) | std::uint64_t(box.y0);
+    return currentGrid.hash(box) ^ (position * 0x9e3779b97f4a7c15ULL);
+}
+
+
+/**
+ * World::advance_until_stable(steps, toroidal, max_period)
+ *
+ * Advance up to a number of steps in the Game of Life, stopping early once the world stops changing.
+ * Should be implemented by invoking World::advance_until_stable(steps, topology, max_period).
+ *
+ * A hash of each generation is kept in a ring of the last max_period generations, along with a copy of its live
+ * box. As soon as the current state matches one in the ring the world is known to repeat forever, so advancing
+ * stops. A matching hash is only a candidate, the copies are compared cell for cell before a period is reported.
+ *      - A world with no alive cells is extinct and stops straight away.
+ *      - A world matching the previous generation is a still life, with a period of 1.
+ *      - A world matching the generation p steps ago is an oscillator with a period of p.
+ *
+ * @example
+ *
+ *      // Make a world with a blinker in it
+ *      Grid grid(8);
+ *      grid.set(3, 4, Cell::ALIVE);
+ *      grid.set(4, 4, Cell::ALIVE);
+ *      grid.set(5, 4, Cell::ALIVE);
+ *      World world(grid);
+ *
+ *      // Stops after 2 steps with a period of 2 starting at generation 0
+ *      Stability stability = world.advance_until_stable(1000);
+ *
+ * @param steps
+ *      The largest number of steps to advance the world forward.
+ *
+ * @param toroidal
+ *      Optional parameter. If true then the step will consider the grid as a torus, where the left edge
+ *      wraps to the right edge and the top to the bottom. Defaults to false.
+ *
+ * @param max_period
+ *      Optional parameter. The longest period of oscillation that can be detected. Defaults to 64.
+ *
+ * @return
+ *      Returns the detected period and the generation it began, or a period of 0 if every step was taken.
+ */
+Stability World::advance_until_stable(int steps, bool toroidal, int max_period){
+    return advance_until_stable(steps, toroidal ? Topology::TORUS : Topology::PLANE, max_period);
+}
+
+/**
+ * World::advance_until_stable(steps, topology, max_period)
+ *
+ * Advance up to a number of steps in the world's rule, with the edges of the world joined according to a
+ * topology, stopping early once the world stops changing. Behaves as World::advance_until_stable(steps,
+ * toroidal, max_period) does. Should be implemented by invoking World::step(topology).
+ *
+ * @param steps
+ *      The largest number of steps to advance the world forward.
+ *
+ * @param topology
+ *      How the edges of the world are joined.
+ *
+ * @param max_period
+ *      Optional parameter. The longest period of oscillation that can be detected. Defaults to 64.
+ *
+ * @return
+ *      Returns the detected period and the generation it began, or a period of 0 if every step was taken.
+ */
+Stability World::advance_until_stable(int steps, Topology topology, int max_period){
+    Stability stability = {false, 0, 0, 0};
+    max_period = std::max(max_period, 1);
+
+    /*ring of the most recent hashes, the hash for generation g lives at g % max_period, along with a copy of the
+    live box and its cells so that a matching hash can be checked against the real state*/
+    std::vector<std::uint64_t> ring(max_period);
+    std::vector<int> ringGeneration(max_period, -1);
+    std::vector<Bounds> ringBounds(max_period);
+    std::vector<Grid> ringCells(max_period);
+    auto remember = [&](std::uint64_t hash){
+        int slot = generation % max_period;
+        Bounds box = get_bounding_box();
+        ring[slot] = hash;
+        ringGeneration[slot] = generation;
+        ringBounds[slot] = box;
+        ringCells[slot] = (box.x0 < box.x1) ? currentGrid.crop(box.x0, box.y0, box.x1, box.y1) : Grid();
+    };
+    //gets whether the current state is the one remembered in a slot
+    auto matches = [&](int slot){
+        Bounds box = get_bounding_box();
+        const Bounds& old = ringBounds[slot];
+        if(box.x0 != old.x0 || box.y0 != old.y0 || box.x1 != old.x1 || box.y1 != old.y1){
+            return false;
+        }
+        for(int y = box.y0; y < box.y1; y++){
+            for(int x = box.x0; x < box.x1; x++){
+                if(currentGrid.get(x, y) != ringCells[slot].get(x - box.x0, y - box.y0)){
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    remember(state_hash());
+
+    /*loop that steps until the world repeats or the steps run out, an empty world
+    can only change if the rule gives birth to cells with no neighbours or the boundary is alive*/
+    bool spontaneous = rule.get_transition(Cell::DEAD, 0) == Cell::ALIVE || topology == Topology::BOUNDARY_ALIVE;
+    while((liveBounds.x0 < liveBounds.x1 || spontaneous) && stability.steps < steps){
+        step(topology);
+        stability.steps++;
+        std::uint64_t hash = state_hash();
+
+        //compare against the nearest generations first to find the shortest period
+        for(int p = 1; p <= max_period && p <= generation; p++){
+            int slot = (generation - p) % max_period;
+            if(ringGeneration[slot] == generation - p && ring[slot] == hash && matches(slot)){
+                stability.period = p;
+                stability.start = generation - p;
+                return stability;
+            }
+        }
+        remember(hash);
+    }
+
+    //an empty world never changes again
+    if(liveBounds.x0 >= liveBounds.x1 && !spontaneous){
+        stability.extinct = true;
+        stability.period = 1;
+        stability.start = generation;
     }
+    return stability;
 }
@@ -13,6 +13,51 @@
 // Add the minimal number of includes you need in order to declare the class.
 // #include ...
 #include "grid.h"
+#include "rule.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+class BandPool;
+class FramePublisher;
+class SnapshotStore;
+class WorldSnapshot;
+
+/**
+ * A Stability reports how far a world got when advanced with World::advance_until_stable.
+ *      - period is 1 for a still life, p for a period p oscillator, or 0 if no repeat was found.
+ *      - start is the generation the repeating cycle began on.
+ *      - extinct is true if every cell died, which counts as a still life.
+ *      - steps is the number of steps that were actually taken.
+ */
+struct Stability {
+    bool extinct;
+    int period;
+    int start;
+    int steps;
+};
+
+/**
+ * A Topology says how the edges of a world are joined, see World::step(topology).
+ *      - PLANE has dead cells beyond every edge.
+ *      - TORUS joins the left edge to the right and the top edge to the bottom.
+ *      - CYLINDER_HORIZONTAL joins the left edge to the right, with dead cells beyond the top and bottom.
+ *      - CYLINDER_VERTICAL joins the top edge to the bottom, with dead cells beyond the left and right.
+ *      - KLEIN_BOTTLE joins the left edge to the right, and the top edge to the bottom mirrored left to right.
+ *      - CROSS_SURFACE joins the left edge to the right mirrored top to bottom, and the top edge to the bottom
+ *        mirrored left to right.
+ *      - BOUNDARY_ALIVE has alive cells beyond every edge.
+ */
+enum class Topology {
+    PLANE,
+    TORUS,
+    CYLINDER_HORIZONTAL,
+    CYLINDER_VERTICAL,
+    KLEIN_BOTTLE,
+    CROSS_SURFACE,
+    BOUNDARY_ALIVE
+};
 
 /**
  * Declare the structure of the World class for representing a 2d grid world.
@@ -22,12 +67,88 @@
  */
 class World {
     private:
+        /**
+         * A SnapshotLink holds the store a world publishes its snapshots to. A copy of a world must not publish to
+         * the store of the world it was copied from, so a copied link starts empty, while a moved one moves.
+         */
+        struct SnapshotLink {
+            std::shared_ptr<SnapshotStore> store;
+
+            SnapshotLink() = default;
+            SnapshotLink(const SnapshotLink&) {}
+            SnapshotLink(SnapshotLink&&) = default;
+            SnapshotLink& operator=(const SnapshotLink&) { store.reset(); return *this; }
+            SnapshotLink& operator=(SnapshotLink&&) = default;
+        };
+
+        /**
+         * A PoolLink holds the threads a world steps its bands on. Threads can't be shared between worlds stepped
+         * at the same time, so a copied link starts empty and the copy starts its own threads when it first needs
+         * them, while a moved one moves.
+         */
+        struct PoolLink {
+            std::shared_ptr<BandPool> pool;
+
+            PoolLink() = default;
+            PoolLink(const PoolLink&) {}
+            PoolLink(PoolLink&&) = default;
+            PoolLink& operator=(const PoolLink&) { pool.reset(); return *this; }
+            PoolLink& operator=(PoolLink&&) = default;
+        };
+
         int width;
         int height;
         Grid currentGrid;
         Grid nextGrid;
+        Bounds liveBounds;
+        Bounds staleBounds;
+        int generation;
+        Rule rule;
+        FramePublisher* publisher;
+        int publishEvery;
+        SnapshotLink snapshots;
+        int threads;
+        bool pinned;
+        bool hugePages;
+        std::vector<int> cpus;
+        PoolLink bands;
+        std::vector<std::uint8_t> tileAlive;
+        std::vector<std::uint8_t> tileStale;
+        std::vector<Bounds> tileDirty;
+        std::vector<int> dirtyTiles;
+        bool dirtyKnown;
+        Topology dirtyTopology;
+        bool looseBounds;
+
+        std::vector<std::uint8_t> haloRows[2];
+        std::vector<std::uint8_t> haloColumns[2];
+        std::vector<std::uint8_t> rowBuffers[3];
 
-        int count_neighbours(int x, int y, bool toroidal);
+        void fill_halos(Topology topology);
+        void load_row(int y, int x0, int x1, std::uint8_t* row);
+        Bounds get_step_region(Topology topology);
+        template <bool Standard, typename Load>
+        Bounds step_region(Bounds region, std::vector<std::uint8_t>* buffers, Grid& to, const Load& load,
+                           Bounds& changed);
+        template <typename Load>
+        Bounds step_region_isotropic(Bounds region, std::vector<std::uint8_t>* buffers, Grid& to, const Load& load,
+                                     Bounds& changed);
+        template <typename Load>
+        Bounds step_rows(Bounds region, std::vector<std::uint8_t>* buffers, Grid& to, const Load& load,
+                         Bounds& changed);
+        Bounds step_rows(Bounds region, std::vector<std::uint8_t>* buffers, Bounds& changed);
+        Bounds step_tiles(Bounds region, Topology topology, std::vector<Bounds>& changed);
+        void step_parts(const std::vector<Bounds>& parts, std::vector<Bounds>& boxes, std::vector<Bounds>& changed);
+        bool step_dirty(Bounds region, Topology topology, Bounds& box, std::vector<Bounds>& changed);
+        void mark_dirty(Bounds box);
+        void add_dirty(Bounds area);
+        void set_dirty(const std::vector<Bounds>& changed);
+        bool can_pipeline(int steps, Topology topology);
+        void advance_pipelined(int steps, Topology topology);
+        void run_bands(const std::function<void(int, int, int)>& work);
+        void place_grids();
+        void publish_snapshot();
+        std::uint64_t state_hash();
 
     public:
         World();
@@ -42,11 +163,26 @@ class World {
         int get_dead_cells();
 
         const Grid& get_state();
+        Bounds get_bounding_box();
+        int get_generation();
+
+        const Rule& get_rule();
+        void set_rule(Rule new_rule);
+        void set_publisher(FramePublisher* new_publisher, int every = 1);
+        void enable_snapshots();
+        WorldSnapshot snapshot() const;
+        void set_threads(int new_threads, bool pin = true, bool huge_pages = false);
+        void set_cell(int x, int y, Cell state);
+        void set_cells(const Grid& cells, int x0, int y0);
         void resize(int square_size);
         void resize(int new_width, int new_height);
 
         void step(bool toroidal = false);
+        void step(Topology topology);
         void advance(int steps, bool toroidal = false);
+        void advance(int steps, Topology topology);
+        Stability advance_until_stable(int steps, bool toroidal = false, int max_period = 64);
+        Stability advance_until_stable(int steps, Topology topology, int max_period = 64);
 
     // How to draw an owl:
     //      Step 1. Draw a circle.
@@ -0,0 +1,1277 @@
+/**
+ * Implements the WorldServer and WorldClient classes for hosting many worlds in one long-running process.
+ *      - A WorldServer listens on a Unix domain socket and hosts any number of worlds, each named by an id, for as
+ *        many clients as connect. Creating, stepping and reading a world is then a message on an open socket
+ *        rather than starting a process, so stepping a small world takes microseconds.
+ *          - The server answers on a fixed pool of threads. Each thread runs its own epoll event loop over the
+ *            connections it accepted, and answers short requests straight away on the thread that read them.
+ *          - Long requests, such as stepping or copying a big world, making a big world or loading a file, are
+ *            handed to a pool of as many workers, as are requests about a world another thread holds. So a loop
+ *            never waits for a world's lock, and one long request doesn't hold up the other connections of its
+ *            loop. The requests a connection sends after one handed to a worker wait for its answer, so every
+ *            connection is still answered in order.
+ *          - Only one worker at a time takes on requests about a world. Others about the same world are queued on
+ *            it for that worker to answer in turn, so a long ADVANCE holds up one worker rather than every worker
+ *            that picks up a request about its world.
+ *          - Any connection can use any world. Each world has a lock, so requests about the same world take turns,
+ *            while requests about different worlds run in parallel.
+ *          - Worlds are limited to LARGEST_WORLD cells, and files can only be loaded from the directory the server
+ *            was given, if it was given one.
+ *
+ *      - The protocol is binary, in the byte order of the machine, as the client is always on the same machine.
+ *          - Every message is a 32 bit length followed by that many bytes.
+ *          - A request is a ServerRequest byte, the 64 bit id of the world, or 0 for a new one, then its fields.
+ *          - An answer is a status byte, 0 then the fields of the answer, or 1 then the text of the error.
+ *          - Strings are a 32 bit length then their bytes, and numbers are int32 unless said otherwise.
+ *
+ *          Request     Fields                              Answer
+ *          CREATE      width, height, rule                 uint64 id
+ *          LOAD        path of a .gol file in the directory, rule  uint64 id
+ *          STEP        uint8 topology                      int64 generation
+ *          ADVANCE     steps, uint8 topology               int64 generation
+ *          QUERY                                           int64 generation, width, height, int64 alive, bounds
+ *          SNAPSHOT                                        int64 generation, width, height, packed rows
+ *          DESTROY
+ *
+ *          - Snapshots send each row as Grid::get_row_words() uint64 words packed as by Grid::pack_row(y, words).
+ *
+ *      - A WorldClient holds one connection to a server and sends one request at a time, waiting for its answer.
+ *        Errors from the server are thrown as std::runtime_error with the server's message.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "world_server.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include "rule.h"
+#include "zoo.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+//requests longer than this are refused and their connection closed
+static const std::uint32_t LARGEST_REQUEST = 1 << 20;
+
+//the number of events each loop takes from epoll at a time
+static const int EVENTS = 64;
+
+//requests that step or copy more cells than this, counting every step, are handed to a worker
+static const long long INLINE_CELLS = 1 << 20;
+
+//worlds with more cells than this are refused, so no request can make the server run out of memory
+static const long long LARGEST_WORLD = 1LL << 26;
+
+namespace {
+
+/**
+ * A Cursor reads the fields of a message in order, checking that each is there.
+ */
+struct Cursor {
+    const std::uint8_t* bytes;
+    std::size_t length;
+    std::size_t offset;
+};
+
+}
+
+/**
+ * put(bytes, value)
+ *
+ * Helper to append a number to a message.
+ */
+template <typename T>
+static void put(std::vector<std::uint8_t>& bytes, T value){
+    std::size_t end = bytes.size();
+    bytes.resize(end + sizeof(T));
+    std::memcpy(bytes.data() + end, &value, sizeof(T));
+}
+
+/**
+ * put_string(bytes, text)
+ *
+ * Helper to append a string to a message, as its length then its bytes.
+ */
+static void put_string(std::vector<std::uint8_t>& bytes, const std::string& text){
+    put<std::uint32_t>(bytes, static_cast<std::uint32_t>(text.size()));
+    bytes.insert(bytes.end(), text.begin(), text.end());
+}
+
+/**
+ * take(cursor)
+ *
+ * Helper to read the next number of a message, throwing std::runtime_error if the message is too short.
+ */
+template <typename T>
+static T take(Cursor& cursor){
+    //exception
+    if(cursor.length - cursor.offset < sizeof(T)){
+        throw std::runtime_error("message too short");
+    }
+    T value;
+    std::memcpy(&value, cursor.bytes + cursor.offset, sizeof(T));
+    cursor.offset += sizeof(T);
+    return value;
+}
+
+/**
+ * take_string(cursor)
+ *
+ * Helper to read the next string of a message, throwing std::runtime_error if the message is too short.
+ */
+static std::string take_string(Cursor& cursor){
+    std::uint32_t size = take<std::uint32_t>(cursor);
+    //exception
+    if(cursor.length - cursor.offset < size){
+        throw std::runtime_error("message too short");
+    }
+    std::string text(reinterpret_cast<const char*>(cursor.bytes + cursor.offset), size);
+    cursor.offset += size;
+    return text;
+}
+
+/**
+ * take_topology(cursor)
+ *
+ * Helper to read a topology from a message, throwing std::runtime_error if it is not one.
+ */
+static Topology take_topology(Cursor& cursor){
+    std::uint8_t topology = take<std::uint8_t>(cursor);
+    //exception
+    if(topology > static_cast<std::uint8_t>(Topology::BOUNDARY_ALIVE)){
+        throw std::runtime_error("unknown topology");
+    }
+    return static_cast<Topology>(topology);
+}
+
+/**
+ * get_address(path)
+ *
+ * Helper to get the address of a Unix domain socket, throwing std::runtime_error if the path is too long for one.
+ */
+static sockaddr_un get_address(const std::string& path){
+    sockaddr_un address = {};
+    //exception
+    if(path.empty() || path.size() >= sizeof(address.sun_path)){
+        throw std::runtime_error("socket path empty or too long");
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    return address;
+}
+
+/**
+ * WorldServer::WorldServer(path, threads, directory)
+ *
+ * Construct a server with no worlds, listening on a Unix domain socket. Clients can connect straight away, but are
+ * not answered until WorldServer::serve() is called. A socket left at the path by an earlier server is replaced.
+ *
+ * @example
+ *
+ *      // Host worlds on 4 threads until stopped, letting clients load the patterns in /srv/patterns
+ *      WorldServer server("/tmp/life.sock", 4, "/srv/patterns");
+ *      server.serve();
+ *
+ * @param path
+ *      The path of the socket.
+ *
+ * @param threads
+ *      Optional parameter. The number of threads to answer on, and of workers, 0 for one per core. Defaults to 0.
+ *
+ * @param directory
+ *      Optional parameter. The directory clients can load files from, or empty to refuse every load. Defaults to
+ *      empty.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The number of threads is negative.
+ *          - The directory is given but is not a directory.
+ *          - The path is empty, too long for a socket, or already used by something other than a socket.
+ *          - The socket cannot be made, bound or listened on.
+ */
+WorldServer::WorldServer(std::string path, int threads, std::string directory){
+    //exception
+    if(threads < 0){
+        throw std::runtime_error("number of threads must not be negative");
+    }
+    sockaddr_un address = get_address(path);
+    this->path = path;
+    this->threads = (threads == 0) ? std::max(1, int(std::thread::hardware_concurrency())) : threads;
+    this->requests = 0;
+    this->nextId = 1;
+    this->stopping = false;
+
+    //keep the directory as its real path, so the files loaded from it can be checked to be inside it
+    if(!directory.empty()){
+        char* real = realpath(directory.c_str(), nullptr);
+        struct stat status;
+        bool found = real != nullptr && stat(real, &status) == 0 && S_ISDIR(status.st_mode);
+        if(real != nullptr){
+            this->directory = real;
+            std::free(real);
+        }
+        //exception
+        if(!found){
+            throw std::runtime_error("no directory " + directory);
+        }
+    }
+
+    //remove a socket left behind by a server that has gone, but nothing else
+    struct stat status;
+    if(stat(path.c_str(), &status) == 0 && S_ISSOCK(status.st_mode)){
+        unlink(path.c_str());
+    }
+
+    listener = ::socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    //exception
+    if(listener < 0){
+        throw std::runtime_error("could not make socket");
+    }
+    //exception
+    if(bind(listener, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listener, SOMAXCONN) != 0){
+        close(listener);
+        throw std::runtime_error("could not listen on socket " + path);
+    }
+    wakeup = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    //exception
+    if(wakeup < 0){
+        close(listener);
+        unlink(path.c_str());
+        throw std::runtime_error("could not make event");
+    }
+}
+
+/**
+ * WorldServer::~WorldServer()
+ *
+ * Close the socket and remove it from the file system. The server must no longer be serving.
+ */
+WorldServer::~WorldServer(){
+    close(wakeup);
+    close(listener);
+    unlink(path.c_str());
+}
+
+/**
+ * WorldServer::get_threads()
+ *
+ * Gets the number of threads the server answers on.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of threads.
+ */
+int WorldServer::get_threads() const{
+    return threads;
+}
+
+/**
+ * WorldServer::get_requests()
+ *
+ * Gets the number of requests the server has answered, including those it answered with an error.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of requests.
+ */
+long long WorldServer::get_requests() const{
+    return requests.load(std::memory_order_relaxed);
+}
+
+/**
+ * WorldServer::get_worlds()
+ *
+ * Gets the number of worlds the server is hosting.
+ *
+ * @return
+ *      The number of worlds.
+ */
+std::size_t WorldServer::get_worlds(){
+    std::shared_lock<std::shared_mutex> lock(worldsMutex);
+    return worlds.size();
+}
+
+/**
+ * WorldServer::serve()
+ *
+ * Answer clients on the server's threads and workers until WorldServer::stop() is called from another thread, then
+ * close every connection and return once the workers have finished the requests they started. The calling thread
+ * waits for the others. A server can only serve once.
+ *
+ * @example
+ *
+ *      // Serve in the background, then stop
+ *      WorldServer server("/tmp/life.sock");
+ *      std::thread serving([&](){ server.serve(); });
+ *      ...
+ *      server.stop();
+ *      serving.join();
+ *
+ * @throws
+ *      std::runtime_error or sub-class if the event loops cannot be set up.
+ */
+void WorldServer::serve(){
+    //closes a loop's epoll instance and event
+    auto close_loop = [](Loop& loop){
+        if(loop.events >= 0){
+            close(loop.events);
+        }
+        if(loop.finished >= 0){
+            close(loop.finished);
+        }
+    };
+
+    /*set up an epoll instance for each thread, every one watching the listening socket, the stop event and the
+    event its workers signal when they finish a job*/
+    std::vector<std::unique_ptr<Loop>> loops;
+    for(int thread = 0; thread < threads; thread++){
+        std::unique_ptr<Loop> loop(new Loop());
+        loop->events = epoll_create1(EPOLL_CLOEXEC);
+        loop->finished = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        epoll_event listen = {};
+        listen.events = EPOLLIN | EPOLLEXCLUSIVE;
+        listen.data.fd = listener;
+        epoll_event stopped = {};
+        stopped.events = EPOLLIN;
+        stopped.data.fd = wakeup;
+        epoll_event finished = {};
+        finished.events = EPOLLIN;
+        finished.data.fd = loop->finished;
+        if(loop->events < 0 || loop->finished < 0 || epoll_ctl(loop->events, EPOLL_CTL_ADD, listener, &listen) != 0 ||
+            epoll_ctl(loop->events, EPOLL_CTL_ADD, wakeup, &stopped) != 0 ||
+            epoll_ctl(loop->events, EPOLL_CTL_ADD, loop->finished, &finished) != 0){
+            close_loop(*loop);
+            for(std::unique_ptr<Loop>& other : loops){
+                close_loop(*other);
+            }
+            //exception
+            throw std::runtime_error("could not set up event loop");
+        }
+        loops.push_back(std::move(loop));
+    }
+
+    stopping = false;
+    std::vector<std::thread> workers;
+    for(int worker = 0; worker < threads; worker++){
+        workers.emplace_back([this](){
+            run_worker();
+        });
+    }
+    std::vector<std::thread> answering;
+    for(std::unique_ptr<Loop>& loop : loops){
+        Loop* running = loop.get();
+        answering.emplace_back([this, running](){
+            run_loop(*running);
+        });
+    }
+    for(std::thread& thread : answering){
+        thread.join();
+    }
+
+    //the workers finish the jobs they have started, drop the rest and hand nothing back once the loops are gone
+    {
+        std::lock_guard<std::mutex> lock(jobsMutex);
+        stopping = true;
+        jobs.clear();
+    }
+    jobsReady.notify_all();
+    for(std::thread& worker : workers){
+        worker.join();
+    }
+    for(std::unique_ptr<Loop>& loop : loops){
+        close_loop(*loop);
+    }
+}
+
+/**
+ * WorldServer::stop()
+ *
+ * Make every thread of WorldServer::serve() finish the requests it has read and return. Safe to call from any
+ * thread, including from a signal handler's thread.
+ */
+void WorldServer::stop(){
+    //the event is never read, so it stays ready and wakes every loop
+    std::uint64_t one = 1;
+    ssize_t written = write(wakeup, &one, sizeof(one));
+    (void)written;
+}
+
+/**
+ * WorldServer::run_loop(loop)
+ *
+ * Private helper function to run one thread's event loop until the server is stopped.
+ *
+ * Waiting connections are accepted onto whichever loop epoll wakes, and stay on it. When a connection is readable
+ * everything waiting is read, every whole request is answered in order and the answers are written back. A request
+ * too long to answer on the loop is handed to a worker, and the connection's later requests wait until the worker
+ * hands its answer back. Answers the socket won't take yet are kept, and the connection is watched for room to write
+ * the rest.
+ *
+ * @param loop
+ *      The loop's epoll instance and the jobs its workers have finished.
+ */
+void WorldServer::run_loop(Loop& loop){
+    /**
+     * A Connection holds the bytes read from a client that don't yet make a whole request, the answers still to be
+     * written back, and whether a worker has the request being answered.
+     */
+    struct Connection {
+        std::vector<std::uint8_t> input;
+        std::vector<std::uint8_t> output;
+        std::size_t sent;
+        std::uint32_t watching;
+        std::uint64_t serial;
+        bool finished;
+        bool busy;
+    };
+    std::unordered_map<int, Connection> connections;
+    std::vector<std::uint8_t> chunk(1 << 16);
+    std::vector<Job> done;
+    epoll_event ready[EVENTS];
+    std::uint64_t serials = 0;
+    bool running = true;
+
+    /*answers a connection's whole requests in order until one is handed to a worker, returning false if a request
+    is too long to take*/
+    auto answer_waiting = [&](int descriptor, Connection& connection){
+        std::size_t offset = 0;
+        bool valid = true;
+        while(!connection.busy && connection.input.size() - offset >= sizeof(std::uint32_t)){
+            std::uint32_t length;
+            std::memcpy(&length, connection.input.data() + offset, sizeof(length));
+            if(length > LARGEST_REQUEST){
+                valid = false;
+                break;
+            }
+            if(connection.input.size() - offset - sizeof(length) < length){
+                break;
+            }
+            const std::uint8_t* request = connection.input.data() + offset + sizeof(length);
+            if(!answer(request, length, connection.output, false)){
+                std::lock_guard<std::mutex> lock(jobsMutex);
+                jobs.push_back({&loop, descriptor, connection.serial, {request, request + length}, {}});
+                jobsReady.notify_one();
+                connection.busy = true;
+            }
+            offset += sizeof(length) + length;
+        }
+        connection.input.erase(connection.input.begin(), connection.input.begin() + offset);
+        return valid;
+    };
+
+    /*writes as much of a connection's answers as the socket will take, then closes it if it is done, otherwise only
+    watches it for room to write while answers are waiting, and stops reading it once the client has finished*/
+    auto write_waiting = [&](std::unordered_map<int, Connection>::iterator found, bool open){
+        int descriptor = found->first;
+        Connection& connection = found->second;
+        while(open && connection.sent < connection.output.size()){
+            ssize_t put = send(descriptor, connection.output.data() + connection.sent,
+                               connection.output.size() - connection.sent, MSG_NOSIGNAL);
+            if(put > 0){
+                connection.sent += std::size_t(put);
+            }else if(put < 0 && errno == EINTR){
+                continue;
+            }else if(put < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)){
+                break;
+            }else{
+                open = false;
+            }
+        }
+        if(connection.sent == connection.output.size()){
+            connection.output.clear();
+            connection.sent = 0;
+        }
+
+        if(!open || (connection.finished && !connection.busy && connection.output.empty())){
+            epoll_ctl(loop.events, EPOLL_CTL_DEL, descriptor, nullptr);
+            close(descriptor);
+            connections.erase(found);
+            return;
+        }
+        std::uint32_t watching = (connection.finished ? 0u : std::uint32_t(EPOLLIN | EPOLLRDHUP)) |
+                                 (connection.output.empty() ? 0u : std::uint32_t(EPOLLOUT));
+        if(watching != connection.watching){
+            epoll_event event = {};
+            event.events = watching;
+            event.data.fd = descriptor;
+            epoll_ctl(loop.events, EPOLL_CTL_MOD, descriptor, &event);
+            connection.watching = watching;
+        }
+    };
+
+    while(running){
+        int count = epoll_wait(loop.events, ready, EVENTS, -1);
+        if(count < 0){
+            if(errno == EINTR){
+                continue;
+            }
+            break;
+        }
+        for(int i = 0; i < count; i++){
+            int descriptor = ready[i].data.fd;
+            if(descriptor == wakeup){
+                running = false;
+                continue;
+            }
+
+            //loop that accepts every waiting client onto this thread's loop
+            if(descriptor == listener){
+                int client;
+                while((client = accept4(listener, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC)) >= 0){
+                    epoll_event event = {};
+                    event.events = EPOLLIN | EPOLLRDHUP;
+                    event.data.fd = client;
+                    if(epoll_ctl(loop.events, EPOLL_CTL_ADD, client, &event) != 0){
+                        close(client);
+                        continue;
+                    }
+                    connections[client] = {{}, {}, 0, EPOLLIN | EPOLLRDHUP, serials++, false, false};
+                }
+                continue;
+            }
+
+            //take the answers the workers have finished, then carry on with the requests waiting behind them
+            if(descriptor == loop.finished){
+                std::uint64_t signalled;
+                ssize_t got = read(loop.finished, &signalled, sizeof(signalled));
+                (void)got;
+                {
+                    std::lock_guard<std::mutex> lock(loop.mutex);
+                    done.swap(loop.done);
+                }
+                for(Job& job : done){
+                    //a connection closed while its job was out is gone, or its descriptor belongs to a new one
+                    auto found = connections.find(job.descriptor);
+                    if(found == connections.end() || found->second.serial != job.serial){
+                        continue;
+                    }
+                    Connection& connection = found->second;
+                    connection.output.insert(connection.output.end(), job.answer.begin(), job.answer.end());
+                    connection.busy = false;
+                    write_waiting(found, answer_waiting(job.descriptor, connection));
+                }
+                done.clear();
+                continue;
+            }
+
+            auto found = connections.find(descriptor);
+            if(found == connections.end()){
+                continue;
+            }
+            Connection& connection = found->second;
+            bool open = true;
+
+            //read everything waiting, then answer every whole request in order
+            if(ready[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)){
+                while(true){
+                    ssize_t got = recv(descriptor, chunk.data(), chunk.size(), 0);
+                    if(got > 0){
+                        connection.input.insert(connection.input.end(), chunk.data(), chunk.data() + got);
+                        continue;
+                    }
+                    if(got < 0 && errno == EINTR){
+                        continue;
+                    }
+                    if(got == 0){
+                        connection.finished = true;
+                    }else if(errno != EAGAIN && errno != EWOULDBLOCK){
+                        open = false;
+                    }
+                    break;
+                }
+                if(!answer_waiting(descriptor, connection)){
+                    open = false;
+                }
+
+                //a client that has hung up entirely can't be answered, and would keep waking the loop until closed
+                if(ready[i].events & (EPOLLHUP | EPOLLERR)){
+                    open = false;
+                }
+            }
+            write_waiting(found, open);
+        }
+    }
+
+    for(auto& connection : connections){
+        close(connection.first);
+    }
+}
+
+/**
+ * WorldServer::run_worker()
+ *
+ * Private helper function to answer the requests handed over by the event loops until the server is stopped, handing
+ * each answer back to the loop of its connection.
+ *
+ * A worker claims the world a request is about before answering it. A request about a world another worker has
+ * claimed is parked on the world instead, and the worker moves on to the next request, so workers never wait on each
+ * other. The worker that has a world answers the requests parked on it in order before giving it up.
+ */
+void WorldServer::run_worker(){
+    //hands an answered job back to the event loop of its connection
+    auto hand_back = [](Job& job){
+        Loop* loop = job.loop;
+        {
+            std::lock_guard<std::mutex> lock(loop->mutex);
+            loop->done.push_back(std::move(job));
+        }
+        std::uint64_t one = 1;
+        ssize_t written = write(loop->finished, &one, sizeof(one));
+        (void)written;
+    };
+
+    while(true){
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(jobsMutex);
+            jobsReady.wait(lock, [this](){
+                return stopping || !jobs.empty();
+            });
+            if(stopping){
+                return;
+            }
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+
+        std::shared_ptr<Hosted> hosted = find_job_world(job);
+        if(hosted){
+            std::lock_guard<std::mutex> lock(jobsMutex);
+            if(hosted->claimed){
+                hosted->parked.push_back(std::move(job));
+                continue;
+            }
+            hosted->claimed = true;
+        }
+
+        //loop that answers the job, then every job parked on its world meanwhile, dropping them once stopping
+        while(true){
+            answer(job.request.data(), job.request.size(), job.answer, true);
+            hand_back(job);
+            if(!hosted){
+                break;
+            }
+            std::lock_guard<std::mutex> lock(jobsMutex);
+            if(stopping || hosted->parked.empty()){
+                hosted->parked.clear();
+                hosted->claimed = false;
+                break;
+            }
+            job = std::move(hosted->parked.front());
+            hosted->parked.pop_front();
+        }
+    }
+}
+
+/**
+ * WorldServer::find_job_world(job)
+ *
+ * Private helper function to find the hosted world a job waits on the lock of.
+ *
+ * @param job
+ *      The job.
+ *
+ * @return
+ *      The world the job steps or reads, or nullptr if it is a request that doesn't lock a world or its world is gone.
+ */
+std::shared_ptr<WorldServer::Hosted> WorldServer::find_job_world(const Job& job){
+    if(job.request.size() < sizeof(std::uint8_t) + sizeof(std::uint64_t)){
+        return nullptr;
+    }
+    ServerRequest kind = static_cast<ServerRequest>(job.request[0]);
+    if(kind != ServerRequest::STEP && kind != ServerRequest::ADVANCE && kind != ServerRequest::QUERY &&
+       kind != ServerRequest::SNAPSHOT){
+        return nullptr;
+    }
+    std::uint64_t id;
+    std::memcpy(&id, job.request.data() + sizeof(std::uint8_t), sizeof(id));
+    std::shared_lock<std::shared_mutex> lock(worldsMutex);
+    auto found = worlds.find(id);
+    return (found == worlds.end()) ? nullptr : found->second;
+}
+
+/**
+ * WorldServer::find_world(id)
+ *
+ * Private helper function to find a hosted world by its id.
+ *
+ * @param id
+ *      The id of the world.
+ *
+ * @return
+ *      The world and its lock, kept alive while the caller holds it even if the world is destroyed meanwhile.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if the server hosts no world with the id.
+ */
+std::shared_ptr<WorldServer::Hosted> WorldServer::find_world(std::uint64_t id){
+    std::shared_lock<std::shared_mutex> lock(worldsMutex);
+    auto found = worlds.find(id);
+    //exception
+    if(found == worlds.end()){
+        throw std::runtime_error("no world with id " + std::to_string(id));
+    }
+    return found->second;
+}
+
+/**
+ * WorldServer::add_world(world)
+ *
+ * Private helper function to host a new world.
+ *
+ * @param world
+ *      The world to host.
+ *
+ * @return
+ *      The id of the new world.
+ */
+std::uint64_t WorldServer::add_world(const World& world){
+    std::shared_ptr<Hosted> hosted = std::make_shared<Hosted>();
+    hosted->world = world;
+    std::unique_lock<std::shared_mutex> lock(worldsMutex);
+    std::uint64_t id = nextId++;
+    worlds[id] = hosted;
+    return id;
+}
+
+/**
+ * WorldServer::find_file(file)
+ *
+ * Private helper function to find a file a client asked to load in the server's directory.
+ *
+ * @param file
+ *      The path of the file, relative to the directory.
+ *
+ * @return
+ *      The real path of the file.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if the server was given no directory, there is no such file, or the path
+ *      leads outside the directory, such as through .. or a link.
+ */
+std::string WorldServer::find_file(const std::string& file){
+    //exception
+    if(directory.empty()){
+        throw std::runtime_error("loading files is not enabled on this server");
+    }
+    char* real = realpath((directory + "/" + file).c_str(), nullptr);
+    //exception
+    if(real == nullptr){
+        throw std::runtime_error("no file " + file);
+    }
+    std::string found = real;
+    std::free(real);
+
+    std::string inside = (directory == "/") ? directory : directory + "/";
+    //exception
+    if(found.compare(0, inside.size(), inside) != 0){
+        throw std::runtime_error("file outside the server's directory " + file);
+    }
+    return found;
+}
+
+/**
+ * WorldServer::answer(request, length, output, waiting)
+ *
+ * Private helper function to carry out a request and append its answer to a connection's output, as a message.
+ * Any error is sent back as the answer rather than thrown, so one bad request does not end its connection.
+ *
+ * An event loop answers without waiting, and gets false back for a request that would step or copy more than
+ * INLINE_CELLS cells, load a file, or wait for a world another thread holds, which it then hands to a worker.
+ *
+ * @param request
+ *      Pointer to the bytes of the request, without its length.
+ *
+ * @param length
+ *      The number of bytes in the request.
+ *
+ * @param output
+ *      The answers waiting to be written to the connection, which the answer is added to.
+ *
+ * @param waiting
+ *      True to answer any request, false to only answer one that is short and needs no waiting.
+ *
+ * @return
+ *      True if the request was answered, false if it was left for a worker and nothing was added to the output.
+ */
+bool WorldServer::answer(const std::uint8_t* request, std::size_t length, std::vector<std::uint8_t>& output,
+                         bool waiting){
+    std::size_t start = output.size();
+    put<std::uint32_t>(output, 0);
+    put<std::uint8_t>(output, 0);
+
+    /*locks a world, unless answering without waiting and either another thread holds it or the request would work
+    on too many cells, counting every pass over them*/
+    auto lock_world = [waiting](std::unique_lock<std::mutex>& lock, World& world, long long passes){
+        if(waiting){
+            lock.lock();
+            return true;
+        }
+        if(!lock.try_lock()){
+            return false;
+        }
+        if((long long)world.get_width() * world.get_height() * passes > INLINE_CELLS){
+            lock.unlock();
+            return false;
+        }
+        return true;
+    };
+
+    try{
+        Cursor cursor = {request, length, 0};
+        ServerRequest kind = static_cast<ServerRequest>(take<std::uint8_t>(cursor));
+        std::uint64_t id = take<std::uint64_t>(cursor);
+
+        switch(kind){
+            case ServerRequest::CREATE:{
+                int width = take<std::int32_t>(cursor);
+                int height = take<std::int32_t>(cursor);
+                Rule rule(take_string(cursor));
+                //exception
+                if(width < 0 || height < 0){
+                    throw std::runtime_error("world size must not be negative");
+                }
+                //exception
+                if((long long)width * height > LARGEST_WORLD){
+                    throw std::runtime_error("world larger than " + std::to_string(LARGEST_WORLD) + " cells");
+                }
+                if(!waiting && (long long)width * height > INLINE_CELLS){
+                    output.resize(start);
+                    return false;
+                }
+                World world(width, height);
+                world.set_rule(rule);
+                put<std::uint64_t>(output, add_world(world));
+                break;
+            }
+            case ServerRequest::LOAD:{
+                std::string file = find_file(take_string(cursor));
+                Rule rule(take_string(cursor));
+                if(!waiting){
+                    output.resize(start);
+                    return false;
+                }
+                Grid cells = Zoo::load_ascii(file);
+                //exception
+                if((long long)cells.get_width() * cells.get_height() > LARGEST_WORLD){
+                    throw std::runtime_error("world larger than " + std::to_string(LARGEST_WORLD) + " cells");
+                }
+                World world(cells);
+                world.set_rule(rule);
+                put<std::uint64_t>(output, add_world(world));
+                break;
+            }
+            case ServerRequest::STEP:
+            case ServerRequest::ADVANCE:{
+                int steps = (kind == ServerRequest::STEP) ? 1 : take<std::int32_t>(cursor);
+                Topology topology = take_topology(cursor);
+                //exception
+                if(steps < 0){
+                    throw std::runtime_error("number of steps must not be negative");
+                }
+                std::shared_ptr<Hosted> hosted = find_world(id);
+                std::unique_lock<std::mutex> lock(hosted->mutex, std::defer_lock);
+                if(!lock_world(lock, hosted->world, steps)){
+                    output.resize(start);
+                    return false;
+                }
+                hosted->world.advance(steps, topology);
+                put<std::int64_t>(output, hosted->world.get_generation());
+                break;
+            }
+            case ServerRequest::QUERY:{
+                std::shared_ptr<Hosted> hosted = find_world(id);
+                std::unique_lock<std::mutex> lock(hosted->mutex, std::defer_lock);
+                if(!lock_world(lock, hosted->world, 1)){
+                    output.resize(start);
+                    return false;
+                }
+                Bounds bounds = hosted->world.get_bounding_box();
+                put<std::int64_t>(output, hosted->world.get_generation());
+                put<std::int32_t>(output, hosted->world.get_width());
+                put<std::int32_t>(output, hosted->world.get_height());
+                put<std::int64_t>(output, hosted->world.get_alive_cells());
+                for(int edge : {bounds.x0, bounds.y0, bounds.x1, bounds.y1}){
+                    put<std::int32_t>(output, edge);
+                }
+                break;
+            }
+            case ServerRequest::SNAPSHOT:{
+                std::shared_ptr<Hosted> hosted = find_world(id);
+                std::unique_lock<std::mutex> lock(hosted->mutex, std::defer_lock);
+                if(!lock_world(lock, hosted->world, 1)){
+                    output.resize(start);
+                    return false;
+                }
+                const Grid& grid = hosted->world.get_state();
+                put<std::int64_t>(output, hosted->world.get_generation());
+                put<std::int32_t>(output, grid.get_width());
+                put<std::int32_t>(output, grid.get_height());
+
+                //loop that packs each row straight onto the end of the answer
+                std::vector<std::uint64_t> words(std::size_t(grid.get_row_words()));
+                for(int y = 0; y < grid.get_height(); y++){
+                    grid.pack_row(y, words.data());
+                    std::size_t end = output.size();
+                    output.resize(end + words.size() * sizeof(std::uint64_t));
+                    std::memcpy(output.data() + end, words.data(), words.size() * sizeof(std::uint64_t));
+                }
+                break;
+            }
+            case ServerRequest::DESTROY:{
+                std::unique_lock<std::shared_mutex> lock(worldsMutex);
+                //exception
+                if(worlds.erase(id) == 0){
+                    throw std::runtime_error("no world with id " + std::to_string(id));
+                }
+                break;
+            }
+            default:
+                //exception
+                throw std::runtime_error("unknown request");
+        }
+    }
+    catch(const std::exception& ex){
+        //replace whatever was answered with the error
+        output.resize(start + sizeof(std::uint32_t));
+        put<std::uint8_t>(output, 1);
+        std::string message = ex.what();
+        output.insert(output.end(), message.begin(), message.end());
+    }
+
+    std::uint32_t size = static_cast<std::uint32_t>(output.size() - start - sizeof(std::uint32_t));
+    std::memcpy(output.data() + start, &size, sizeof(size));
+    requests.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+/**
+ * WorldClient::WorldClient(path)
+ *
+ * Connect to a WorldServer.
+ *
+ * @example
+ *
+ *      // Make a world with a glider in it, step it and print it
+ *      WorldClient client("/tmp/life.sock");
+ *      std::uint64_t id = client.create(16, 16);
+ *      client.advance(id, 8);
+ *      Grid grid;
+ *      long long generation;
+ *      client.snapshot(id, grid, generation);
+ *      std::cout << grid << std::endl;
+ *
+ * @param path
+ *      The path of the server's socket.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if the path is not valid for a socket or there is no server listening on it.
+ */
+WorldClient::WorldClient(std::string path){
+    sockaddr_un address = get_address(path);
+    socket = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    //exception
+    if(socket < 0){
+        throw std::runtime_error("could not make socket");
+    }
+    //exception
+    if(connect(socket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0){
+        close(socket);
+        throw std::runtime_error("could not connect to server at " + path);
+    }
+}
+
+/**
+ * WorldClient::~WorldClient()
+ *
+ * Close the connection. The worlds the client made stay on the server.
+ */
+WorldClient::~WorldClient(){
+    close(socket);
+}
+
+/**
+ * WorldClient::begin(kind, id)
+ *
+ * Private helper function to start a new request, ready for its fields to be appended.
+ *
+ * @param kind
+ *      The kind of request.
+ *
+ * @param id
+ *      The id of the world the request is about, or 0 for a new world.
+ */
+void WorldClient::begin(ServerRequest kind, std::uint64_t id){
+    request.clear();
+    put<std::uint32_t>(request, 0);
+    put<std::uint8_t>(request, static_cast<std::uint8_t>(kind));
+    put<std::uint64_t>(request, id);
+}
+
+/**
+ * WorldClient::call()
+ *
+ * Private helper function to send the request and wait for its answer, leaving the fields of the answer in reply
+ * after its status byte.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The connection to the server is lost.
+ *          - The server answers with an error, whose message is thrown.
+ */
+void WorldClient::call(){
+    std::uint32_t size = static_cast<std::uint32_t>(request.size() - sizeof(size));
+    std::memcpy(request.data(), &size, sizeof(size));
+
+    //loop that sends the whole request
+    std::size_t sent = 0;
+    while(sent < request.size()){
+        ssize_t put = send(socket, request.data() + sent, request.size() - sent, MSG_NOSIGNAL);
+        if(put < 0 && errno == EINTR){
+            continue;
+        }
+        //exception
+        if(put <= 0){
+            throw std::runtime_error("lost connection to server");
+        }
+        sent += std::size_t(put);
+    }
+
+    //reads exactly count bytes of the answer
+    auto receive = [this](std::uint8_t* bytes, std::size_t count){
+        std::size_t got = 0;
+        while(got < count){
+            ssize_t read = recv(socket, bytes + got, count - got, 0);
+            if(read < 0 && errno == EINTR){
+                continue;
+            }
+            //exception
+            if(read <= 0){
+                throw std::runtime_error("lost connection to server");
+            }
+            got += std::size_t(read);
+        }
+    };
+    std::uint32_t length;
+    receive(reinterpret_cast<std::uint8_t*>(&length), sizeof(length));
+    reply.resize(length);
+    receive(reply.data(), length);
+
+    //exception
+    if(reply.empty()){
+        throw std::runtime_error("empty answer from server");
+    }
+    //exception
+    if(reply[0] != 0){
+        throw std::runtime_error(std::string(reply.begin() + 1, reply.end()));
+    }
+}
+
+/**
+ * WorldClient::create(width, height, rule)
+ *
+ * Make a new world of dead cells on the server.
+ *
+ * @param width
+ *      The width of the world.
+ *
+ * @param height
+ *      The height of the world.
+ *
+ * @param rule
+ *      Optional parameter. The world's rule in B/S or Hensel notation. Defaults to Conway's rule.
+ *
+ * @return
+ *      The id of the new world.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if the size is negative or more than the server allows, or the rule is not
+ *      valid.
+ */
+std::uint64_t WorldClient::create(int width, int height, std::string rule){
+    begin(ServerRequest::CREATE, 0);
+    put<std::int32_t>(request, width);
+    put<std::int32_t>(request, height);
+    put_string(request, rule);
+    call();
+    Cursor cursor = {reply.data(), reply.size(), 1};
+    return take<std::uint64_t>(cursor);
+}
+
+/**
+ * WorldClient::load(path, rule)
+ *
+ * Make a new world on the server from an ascii .gol file, read by the server from the directory it was given.
+ *
+ * @param path
+ *      The path of the file, relative to the server's directory.
+ *
+ * @param rule
+ *      Optional parameter. The world's rule in B/S or Hensel notation. Defaults to Conway's rule.
+ *
+ * @return
+ *      The id of the new world.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if the server loads no files, the file is not in its directory or cannot be
+ *      loaded, the world is too large, or the rule is not valid.
+ */
+std::uint64_t WorldClient::load(std::string path, std::string rule){
+    begin(ServerRequest::LOAD, 0);
+    put_string(request, path);
+    put_string(request, rule);
+    call();
+    Cursor cursor = {reply.data(), reply.size(), 1};
+    return take<std::uint64_t>(cursor);
+}
+
+/**
+ * WorldClient::step(id, topology)
+ *
+ * Step a world on the server once.
+ *
+ * @param id
+ *      The id of the world.
+ *
+ * @param topology
+ *      Optional parameter. How the edges of the world are joined. Defaults to a plane.
+ *
+ * @return
+ *      The world's generation after the step.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if there is no world with the id.
+ */
+long long WorldClient::step(std::uint64_t id, Topology topology){
+    begin(ServerRequest::STEP, id);
+    put<std::uint8_t>(request, static_cast<std::uint8_t>(topology));
+    call();
+    Cursor cursor = {reply.data(), reply.size(), 1};
+    return take<std::int64_t>(cursor);
+}
+
+/**
+ * WorldClient::advance(id, steps, topology)
+ *
+ * Step a world on the server many times.
+ *
+ * @param id
+ *      The id of the world.
+ *
+ * @param steps
+ *      The number of steps.
+ *
+ * @param topology
+ *      Optional parameter. How the edges of the world are joined. Defaults to a plane.
+ *
+ * @return
+ *      The world's generation after the steps.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if there is no world with the id or the number of steps is negative.
+ */
+long long WorldClient::advance(std::uint64_t id, int steps, Topology topology){
+    begin(ServerRequest::ADVANCE, id);
+    put<std::int32_t>(request, steps);
+    put<std::uint8_t>(request, static_cast<std::uint8_t>(topology));
+    call();
+    Cursor cursor = {reply.data(), reply.size(), 1};
+    return take<std::int64_t>(cursor);
+}
+
+/**
+ * WorldClient::query(id)
+ *
+ * Get the size, generation and population of a world on the server.
+ *
+ * @param id
+ *      The id of the world.
+ *
+ * @return
+ *      The state of the world.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if there is no world with the id.
+ */
+WorldInfo WorldClient::query(std::uint64_t id){
+    begin(ServerRequest::QUERY, id);
+    call();
+    Cursor cursor = {reply.data(), reply.size(), 1};
+    WorldInfo info;
+    info.generation = take<std::int64_t>(cursor);
+    info.width = take<std::int32_t>(cursor);
+    info.height = take<std::int32_t>(cursor);
+    info.alive = take<std::int64_t>(cursor);
+    info.bounds.x0 = take<std::int32_t>(cursor);
+    info.bounds.y0 = take<std::int32_t>(cursor);
+    info.bounds.x1 = take<std::int32_t>(cursor);
+    info.bounds.y1 = take<std::int32_t>(cursor);
+    return info;
+}
+
+/**
+ * WorldClient::snapshot(id, grid, generation)
+ *
+ * Copy the cells of a world on the server.
+ *
+ * @param id
+ *      The id of the world.
+ *
+ * @param grid
+ *      The grid to copy the cells into, resized to the world if it is not the same size.
+ *
+ * @param generation
+ *      Set to the world's generation.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if there is no world with the id.
+ */
+void WorldClient::snapshot(std::uint64_t id, Grid& grid, long long& generation){
+    begin(ServerRequest::SNAPSHOT, id);
+    call();
+    Cursor cursor = {reply.data(), reply.size(), 1};
+    generation = take<std::int64_t>(cursor);
+    int width = take<std::int32_t>(cursor);
+    int height = take<std::int32_t>(cursor);
+    if(grid.get_width() != width || grid.get_height() != height){
+        grid = Grid(width, height);
+    }
+
+    //nested loops that unpack each row straight into the grid's cells
+    std::vector<std::uint64_t> words(std::size_t(grid.get_row_words()));
+    for(int y = 0; y < height; y++){
+        for(std::uint64_t& word : words){
+            word = take<std::uint64_t>(cursor);
+        }
+        Cell* row = &grid(0, y);
+        for(int x = 0; x < width; x++){
+            row[x] = ((words[x / 64] >> (x % 64)) & 1) ? Cell::ALIVE : Cell::DEAD;
+        }
+    }
+}
+
+/**
+ * WorldClient::destroy(id)
+ *
+ * Remove a world from the server.
+ *
+ * @param id
+ *      The id of the world.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if there is no world with the id.
+ */
+void WorldClient::destroy(std::uint64_t id){
+    begin(ServerRequest::DESTROY, id);
+    call();
+}
@@ -0,0 +1,156 @@
+/**
+ * Declares the WorldServer and WorldClient classes for hosting many worlds in one long-running process.
+ * Rich documentation for the api, behaviour and protocol of the classes can be found in world_server.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include "world.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * The kinds of request a WorldClient can send to a WorldServer, the first byte of every request.
+ */
+enum class ServerRequest : std::uint8_t {
+    CREATE = 1,
+    LOAD,
+    STEP,
+    ADVANCE,
+    QUERY,
+    SNAPSHOT,
+    DESTROY
+};
+
+/**
+ * A WorldInfo reports the state of a world hosted by a WorldServer, in answer to a query.
+ */
+struct WorldInfo {
+    long long generation;
+    int width;
+    int height;
+    long long alive;
+    Bounds bounds;
+};
+
+/**
+ * Declare the structure of the WorldServer class, which hosts worlds for clients connecting over a Unix domain
+ * socket and answers their requests on a fixed pool of threads, each running its own event loop, handing long
+ * requests to a pool of workers.
+ */
+class WorldServer {
+    private:
+        struct Loop;
+
+        /**
+         * A Job is a request handed from an event loop to a worker, and the answer the worker hands back.
+         */
+        struct Job {
+            Loop* loop;
+            int descriptor;
+            std::uint64_t serial;
+            std::vector<std::uint8_t> request;
+            std::vector<std::uint8_t> answer;
+        };
+
+        /**
+         * A Hosted is a world and the lock held by whichever thread is answering a request about it, with whether a
+         * worker has it and the jobs about it waiting for that worker, both guarded by jobsMutex.
+         */
+        struct Hosted {
+            std::mutex mutex;
+            World world;
+            bool claimed = false;
+            std::deque<Job> parked;
+        };
+
+        /**
+         * A Loop is one thread's epoll instance, and the finished jobs its workers have handed back with the event
+         * they signal it on.
+         */
+        struct Loop {
+            int events;
+            int finished;
+            std::mutex mutex;
+            std::vector<Job> done;
+        };
+
+        std::string path;
+        std::string directory;
+        int listener;
+        int wakeup;
+        int threads;
+        std::atomic<long long> requests;
+
+        std::shared_mutex worldsMutex;
+        std::unordered_map<std::uint64_t, std::shared_ptr<Hosted>> worlds;
+        std::uint64_t nextId;
+
+        std::mutex jobsMutex;
+        std::condition_variable jobsReady;
+        std::deque<Job> jobs;
+        bool stopping;
+
+        void run_loop(Loop& loop);
+        void run_worker();
+        std::shared_ptr<Hosted> find_job_world(const Job& job);
+        std::shared_ptr<Hosted> find_world(std::uint64_t id);
+        std::uint64_t add_world(const World& world);
+        std::string find_file(const std::string& file);
+        bool answer(const std::uint8_t* request, std::size_t length, std::vector<std::uint8_t>& output, bool waiting);
+
+    public:
+        WorldServer(std::string path, int threads = 0, std::string directory = "");
+        ~WorldServer();
+        WorldServer(const WorldServer&) = delete;
+        WorldServer& operator=(const WorldServer&) = delete;
+
+        int get_threads() const;
+        long long get_requests() const;
+        std::size_t get_worlds();
+
+        void serve();
+        void stop();
+};
+
+/**
+ * Declare the structure of the WorldClient class, which connects to a WorldServer and sends it one request at a
+ * time, waiting for each answer.
+ */
+class WorldClient {
+    private:
+        int socket;
+        std::vector<std::uint8_t> request;
+        std::vector<std::uint8_t> reply;
+
+        void begin(ServerRequest kind, std::uint64_t id);
+        void call();
+
+    public:
+        WorldClient(std::string path);
+        ~WorldClient();
+        WorldClient(const WorldClient&) = delete;
+        WorldClient& operator=(const WorldClient&) = delete;
+
+        std::uint64_t create(int width, int height, std::string rule = "B3/S23");
+        std::uint64_t load(std::string path, std::string rule = "B3/S23");
+        long long step(std::uint64_t id, Topology topology = Topology::PLANE);
+        long long advance(std::uint64_t id, int steps, Topology topology = Topology::PLANE);
+        WorldInfo query(std::uint64_t id);
+        void snapshot(std::uint64_t id, Grid& grid, long long& generation);
+        void destroy(std::uint64_t id);
+};
@@ -0,0 +1,304 @@
+/**
+ * Implements the WorldSnapshot and SnapshotStore classes for reading a world from other threads while it is stepped.
+ *      - World::get_state() is a reference to the grid the world steps into, so it can't be read by another thread
+ *        while the world is being stepped. Instead a world with snapshots on, see World::enable_snapshots(),
+ *        publishes a copy of each finished generation to a SnapshotStore, and World::snapshot() hands any thread a
+ *        WorldSnapshot of the latest one.
+ *
+ *      - The store keeps a list of slots, each a copy of a generation and a count of the snapshots pinning it.
+ *          - A snapshot pins the latest slot by adding to its count and then checking that the slot is still the
+ *            latest. If it isn't, the slot may be being rewritten, so the snapshot lets go and tries again.
+ *          - The world publishes into any slot other than the latest that nothing pins, copying only the rows and
+ *            columns that differ between the slot's old generation and the new one, and then makes it the latest.
+ *            If every slot is pinned it adds a new slot, so the world never waits for a reader.
+ *          - A reader and the world each write their side, the count or the latest slot, before reading the
+ *            other's, all sequentially consistent, so either the world sees the reader's pin and leaves the slot
+ *            alone or the reader sees the slot is no longer the latest.
+ *          - Neither side ever takes a lock. The world's cost is one copy of the changed part of the grid per
+ *            generation, and a reader's is a copy of a shared pointer.
+ *
+ *      - Snapshots are reference counted handles. Copies pin the same slot, which is free to reuse once the last of
+ *        them is gone. Snapshots keep the store alive, so they can outlive the world they were taken of.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#include "world_snapshot.h"
+
+// Include the minimal number of headers needed to support your implementation.
+// #include ...
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * SnapshotStore::SnapshotStore()
+ *
+ * Construct a store with nothing published yet.
+ */
+SnapshotStore::SnapshotStore(){
+    this->latest = nullptr;
+}
+
+/**
+ * SnapshotStore::get_slots()
+ *
+ * Gets the number of copies the store holds, which only grows while readers hold on to old generations.
+ * Only the publishing thread may call this.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The number of slots.
+ */
+std::size_t SnapshotStore::get_slots() const{
+    return slots.size();
+}
+
+/**
+ * SnapshotStore::publish(cells, bounds, generation)
+ *
+ * Publish a generation, which snapshots taken from now on will see. Only one thread may publish to a store.
+ *
+ * @example
+ *
+ *      // Publish a glider as generation 0
+ *      SnapshotStore store;
+ *      Grid glider = Zoo::glider();
+ *      store.publish(glider, glider.get_bounding_box(), 0);
+ *
+ * @param cells
+ *      The cells of the generation.
+ *
+ * @param bounds
+ *      The bounding box of the alive cells, which must cover every alive cell.
+ *
+ * @param generation
+ *      The number of the generation.
+ */
+void SnapshotStore::publish(const Grid& cells, Bounds bounds, long long generation){
+    Slot* current = latest.load(std::memory_order_relaxed);
+
+    //find a slot that isn't the latest and that no snapshot pins, or add one
+    Slot* target = nullptr;
+    for(const std::unique_ptr<Slot>& slot : slots){
+        if(slot.get() != current && slot->readers.load(std::memory_order_seq_cst) == 0){
+            target = slot.get();
+            break;
+        }
+    }
+    if(target == nullptr){
+        slots.push_back(std::unique_ptr<Slot>(new Slot()));
+        target = slots.back().get();
+        target->readers.store(0);
+        target->bounds = {0, 0, 0, 0};
+    }
+
+    //a slot of the same size only needs the part that was alive in either generation copied, the rest is dead in both
+    if(target->cells.get_width() != cells.get_width() || target->cells.get_height() != cells.get_height()){
+        target->cells = cells;
+    }else{
+        Bounds changed = target->bounds;
+        if(bounds.x0 < bounds.x1 && bounds.y0 < bounds.y1){
+            changed = (changed.x0 < changed.x1 && changed.y0 < changed.y1) ?
+                Bounds{std::min(changed.x0, bounds.x0), std::min(changed.y0, bounds.y0),
+                       std::max(changed.x1, bounds.x1), std::max(changed.y1, bounds.y1)} : bounds;
+        }
+        for(int y = changed.y0; y < changed.y1; y++){
+            const Cell* row = &cells(0, y);
+            std::copy(row + changed.x0, row + changed.x1, &target->cells(changed.x0, y));
+        }
+    }
+    target->bounds = bounds;
+    target->generation = generation;
+
+    latest.store(target, std::memory_order_seq_cst);
+}
+
+/**
+ * WorldSnapshot::WorldSnapshot()
+ *
+ * Construct an empty snapshot, of no world.
+ */
+WorldSnapshot::WorldSnapshot(){
+    this->slot = nullptr;
+}
+
+/**
+ * WorldSnapshot::WorldSnapshot(store)
+ *
+ * Construct a snapshot of the latest generation published to a store, pinning it so it stays unchanged until the
+ * snapshot is gone. Never waits for the publishing thread. Usually made by World::snapshot().
+ *
+ * @example
+ *
+ *      // Watch the population of a world being stepped on another thread
+ *      World world(Zoo::load_ascii("gun.gol"));
+ *      world.enable_snapshots();
+ *      std::thread stepping([&](){ world.advance(100000); });
+ *      for(int i = 0; i < 100; i++){
+ *          WorldSnapshot snapshot = world.snapshot();
+ *          std::cout << snapshot.get_generation() << " " << snapshot.get_state().get_alive_cells() << std::endl;
+ *      }
+ *      stepping.join();
+ *
+ * @param store
+ *      The store to take the snapshot from.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if the store is missing or nothing has been published to it.
+ */
+WorldSnapshot::WorldSnapshot(std::shared_ptr<SnapshotStore> store){
+    //exception
+    if(store == nullptr){
+        throw std::runtime_error("no store to take a snapshot from");
+    }
+    this->store = store;
+
+    //loop that pins the latest slot, trying again if a newer generation was published meanwhile
+    while(true){
+        slot = store->latest.load(std::memory_order_seq_cst);
+        //exception
+        if(slot == nullptr){
+            throw std::runtime_error("nothing published to take a snapshot of");
+        }
+        slot->readers.fetch_add(1, std::memory_order_seq_cst);
+        if(store->latest.load(std::memory_order_seq_cst) == slot){
+            return;
+        }
+        slot->readers.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+/**
+ * WorldSnapshot::WorldSnapshot(other)
+ *
+ * Construct another handle to the same generation as a snapshot.
+ *
+ * @param other
+ *      The snapshot to copy.
+ */
+WorldSnapshot::WorldSnapshot(const WorldSnapshot& other){
+    this->store = other.store;
+    this->slot = other.slot;
+    if(slot != nullptr){
+        slot->readers.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * WorldSnapshot::operator=(other)
+ *
+ * Let go of this snapshot's generation and take another handle to the generation of a snapshot.
+ *
+ * @param other
+ *      The snapshot to copy.
+ *
+ * @return
+ *      This snapshot.
+ */
+WorldSnapshot& WorldSnapshot::operator=(const WorldSnapshot& other){
+    if(this != &other){
+        if(other.slot != nullptr){
+            other.slot->readers.fetch_add(1, std::memory_order_relaxed);
+        }
+        release();
+        store = other.store;
+        slot = other.slot;
+    }
+    return *this;
+}
+
+/**
+ * WorldSnapshot::~WorldSnapshot()
+ *
+ * Let go of the snapshot's generation, so its slot can be reused once no other snapshot holds it.
+ */
+WorldSnapshot::~WorldSnapshot(){
+    release();
+}
+
+/**
+ * WorldSnapshot::release()
+ *
+ * Private helper function to unpin the snapshot's slot, finishing every read of it before the world can reuse it.
+ */
+void WorldSnapshot::release(){
+    if(slot != nullptr){
+        slot->readers.fetch_sub(1, std::memory_order_release);
+        slot = nullptr;
+    }
+}
+
+/**
+ * WorldSnapshot::is_empty()
+ *
+ * Gets whether the snapshot is empty, as made by WorldSnapshot().
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      True if the snapshot is of no world.
+ */
+bool WorldSnapshot::is_empty() const{
+    return slot == nullptr;
+}
+
+/**
+ * WorldSnapshot::get_state()
+ *
+ * Return a read-only reference to the cells of the snapshot's generation, which stay the same while the snapshot
+ * is held.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A reference to the cells.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if the snapshot is empty.
+ */
+const Grid& WorldSnapshot::get_state() const{
+    //exception
+    if(slot == nullptr){
+        throw std::runtime_error("empty snapshot");
+    }
+    return slot->cells;
+}
+
+/**
+ * WorldSnapshot::get_bounding_box()
+ *
+ * Gets a box covering the alive cells of the snapshot's generation. It may be larger than the box
+ * World::get_bounding_box() gives if the world was edited or only stepped around its changes.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      A box covering every alive cell.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if the snapshot is empty.
+ */
+Bounds WorldSnapshot::get_bounding_box() const{
+    //exception
+    if(slot == nullptr){
+        throw std::runtime_error("empty snapshot");
+    }
+    return slot->bounds;
+}
+
+/**
+ * WorldSnapshot::get_generation()
+ *
+ * Gets the number of the snapshot's generation.
+ * The function should be callable from a constant context.
+ *
+ * @return
+ *      The generation.
+ *
+ * @throws
+ *      std::runtime_error or sub-class if the snapshot is empty.
+ */
+long long WorldSnapshot::get_generation() const{
+    //exception
+    if(slot == nullptr){
+        throw std::runtime_error("empty snapshot");
+    }
+    return slot->generation;
+}
@@ -0,0 +1,70 @@
+/**
+ * Declares the WorldSnapshot and SnapshotStore classes for reading a world from other threads while it is stepped.
+ * Rich documentation for the api and behaviour the classes can be found in world_snapshot.cpp.
+ *
+ * @author 931478
+ * @date 18th October, 2026
+ */
+#pragma once
+
+// Add the minimal number of includes you need in order to declare the class.
+// #include ...
+#include "grid.h"
+#include "world.h"
+#include <atomic>
+#include <memory>
+#include <vector>
+
+/**
+ * Declare the structure of the SnapshotStore class, which holds the copies of a world's finished generations that
+ * its snapshots point to. Only the world's stepping thread publishes to a store; any thread can read from it.
+ */
+class SnapshotStore {
+    private:
+        friend class WorldSnapshot;
+
+        /**
+         * A Slot is one copy of a generation and the number of snapshots pinning it.
+         */
+        struct Slot {
+            Grid cells;
+            Bounds bounds;
+            long long generation;
+            std::atomic<long long> readers;
+        };
+
+        std::vector<std::unique_ptr<Slot>> slots;
+        std::atomic<Slot*> latest;
+
+    public:
+        SnapshotStore();
+        SnapshotStore(const SnapshotStore&) = delete;
+        SnapshotStore& operator=(const SnapshotStore&) = delete;
+
+        std::size_t get_slots() const;
+        void publish(const Grid& cells, Bounds bounds, long long generation);
+};
+
+/**
+ * Declare the structure of the WorldSnapshot class, a read-only, reference counted view of one finished generation
+ * of a world, which stays the same however far the world is stepped while the snapshot is held.
+ */
+class WorldSnapshot {
+    private:
+        std::shared_ptr<SnapshotStore> store;
+        SnapshotStore::Slot* slot;
+
+        void release();
+
+    public:
+        WorldSnapshot();
+        explicit WorldSnapshot(std::shared_ptr<SnapshotStore> store);
+        WorldSnapshot(const WorldSnapshot& other);
+        WorldSnapshot& operator=(const WorldSnapshot& other);
+        ~WorldSnapshot();
+
+        bool is_empty() const;
+        const Grid& get_state() const;
+        Bounds get_bounding_box() const;
+        long long get_generation() const;
+};
@@ -18,6 +18,11 @@
  *                padded with zero or more 0 bits.
  *              - a 0 bit should be considered Cell::DEAD, a 1 bit should be considered Cell::ALIVE.
  *
+ *      - StateGrids of multi-state cells can be loaded from and saved to matching ascii and binary formats.
+ *          - Ascii files are the same as for Grids, with dying states 2 to 15 written as the hex digits '2' to 'f'.
+ *          - Binary files have the same header as for Grids, followed by (width * height) number of 4 bit states
+ *            in C-style row/column format, the first cell of each byte in its low 4 bits, padded with a 0 state.
+ *
  * @author 931478
  * @date 17th April, 2020
  */
@@ -398,3 +403,218 @@ void Zoo::save_binary(std::string path, Grid grid){
     outputFile.close();
 }
 
+
+
+/**
+ * Zoo::load_ascii_states(path)
+ *
+ * Load an ascii file and parse it as a grid of multi-state cells.
+ * Two state .gol files load as grids of states 0 and 1.
+ * Should be implemented using std::ifstream.
+ *
+ * @example
+ *
+ *      // Load an ascii file from a directory
+ *      StateGrid grid = Zoo::load_ascii_states("path/to/file.gol");
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @return
+ *      Returns the parsed grid.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The file cannot be opened.
+ *          - The parsed width or height is not a positive integer.
+ *          - The file ends before every cell has been read.
+ *          - The character for a cell is not ' ', '#', or a hex digit from '2' to 'f'.
+ */
+StateGrid Zoo::load_ascii_states(std::string path){
+    std::ifstream inputFile(path);
+    //exception
+    if(!inputFile.is_open()){
+        throw std::runtime_error("can't be opened");
+    }
+    int width = 0;
+    int height = 0;
+    inputFile >> width;
+    inputFile >> height;
+    //exception
+    if(width < 1 || height < 1){
+        throw std::runtime_error("width or height not a positive integer");
+    }
+    StateGrid grid = StateGrid(width,height);
+    std::string symbols = " #23456789abcdef";
+
+    //skip the rest of the header line, then read each row of cells
+    std::string line;
+    getline(inputFile, line);
+    for(int j = 0; j < height; j++){
+        //exception
+        if(!getline(inputFile, line) || int(line.size()) < width){
+            throw std::runtime_error("file ended early");
+        }
+        for(int i = 0; i < width; i++){
+            std::size_t state = symbols.find(char(std::tolower(static_cast<unsigned char>(line[i]))));
+            //exception
+            if(state == std::string::npos){
+                throw std::runtime_error("char not a valid state");
+            }
+            grid.set(i, j, int(state));
+        }
+    }
+
+    return grid;
+}
+
+
+/**
+ * Zoo::save_ascii_states(path, grid)
+ *
+ * Save a grid of multi-state cells as an ascii .gol file according to the specified file format.
+ * Should be implemented using std::ofstream.
+ *
+ * @example
+ *
+ *      // Save the state of a Generations world
+ *      Zoo::save_ascii_states("path/to/file.gol", world.get_state());
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param grid
+ *      The grid to be written out to file.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened.
+ */
+void Zoo::save_ascii_states(std::string path, StateGrid grid){
+    std::ofstream outputFile;
+    outputFile.open(path);
+    //exception
+    if(!outputFile.is_open()){
+        throw std::runtime_error("can't be opened");
+    }
+
+    outputFile << grid.get_width() << " " << grid.get_height() << "\n";
+    const char* symbols = " #23456789abcdef";
+
+    //nested loop that saves a character for each cell to file
+    for(int j = 0; j < grid.get_height(); j++){
+        for(int i = 0; i < grid.get_width(); i++){
+            outputFile << symbols[grid.get(i,j)];
+        }
+        outputFile << "\n";
+    }
+
+    outputFile.close();
+}
+
+
+/**
+ * Zoo::load_binary_states(path)
+ *
+ * Load a binary file of 4 bit states and parse it as a grid of multi-state cells.
+ * Should be implemented using std::ifstream.
+ *
+ * @example
+ *
+ *      // Load an binary file from a directory
+ *      StateGrid grid = Zoo::load_binary_states("path/to/file.sgol");
+ *
+ * @param path
+ *      The std::string path to the file to read in.
+ *
+ * @return
+ *      Returns the parsed grid.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if:
+ *          - The file cannot be opened.
+ *          - The parsed width or height is not a positive integer.
+ *          - The file ends unexpectedly.
+ */
+StateGrid Zoo::load_binary_states(std::string path){
+    int width = 0;
+    int height = 0;
+
+    std::ifstream inputFile(path,std::ios::binary);
+    //exception
+    if(!inputFile.is_open()){
+        throw std::runtime_error("can't be opened");
+    }
+    inputFile.read((char*)&width, 4);
+    inputFile.read((char*)&height, 4);
+    //exception
+    if(!inputFile.good() || width < 1 || height < 1){
+        throw std::runtime_error("width or height not a positive integer");
+    }
+    StateGrid grid = StateGrid(width,height);
+
+    //the bytes hold two cells each in the same order as StateGrid
+    std::vector<char> bytes((std::size_t(width) * height + 1) / 2);
+    inputFile.read(bytes.data(), bytes.size());
+    //exception
+    if(inputFile.gcount() != std::streamsize(bytes.size())){
+        throw std::runtime_error("file ended early");
+    }
+
+    std::vector<std::uint8_t> row(width);
+    for(int j = 0; j < height; j++){
+        for(int i = 0; i < width; i++){
+            std::size_t index = std::size_t(j) * width + i;
+            row[i] = (std::uint8_t(bytes[index / 2]) >> ((index % 2) * 4)) & 0xF;
+        }
+        grid.pack_row(j, row.data());
+    }
+
+    return grid;
+}
+
+
+/**
+ * Zoo::save_binary_states(path, grid)
+ *
+ * Save a grid of multi-state cells as a binary .sgol file of 4 bit states according to the specified file format.
+ * Should be implemented using std::ofstream.
+ *
+ * @example
+ *
+ *      // Save the state of a Generations world
+ *      Zoo::save_binary_states("path/to/file.sgol", world.get_state());
+ *
+ * @param path
+ *      The std::string path to the file to write to.
+ *
+ * @param grid
+ *      The grid to be written out to file.
+ *
+ * @throws
+ *      Throws std::runtime_error or sub-class if the file cannot be opened.
+ */
+void Zoo::save_binary_states(std::string path, StateGrid grid){
+    std::ofstream outputFile(path, std::ios::binary);
+    //exception
+    if(!outputFile.is_open()){
+        throw std::runtime_error("can't be opened");
+    }
+
+    int width = grid.get_width();
+    int height = grid.get_height();
+    outputFile.write((char*)&width, 4);
+    outputFile.write((char*)&height, 4);
+
+    //nested loops that pair up the cells into bytes, low half first
+    std::vector<char> bytes((std::size_t(width) * height + 1) / 2, 0);
+    std::vector<std::uint8_t> row(width);
+    for(int j = 0; j < height; j++){
+        grid.unpack_row(j, row.data());
+        for(int i = 0; i < width; i++){
+            std::size_t index = std::size_t(j) * width + i;
+            bytes[index / 2] = char(std::uint8_t(bytes[index / 2]) | (row[i] << ((index % 2) * 4)));
+        }
+    }
+    outputFile.write(bytes.data(), bytes.size());
+    outputFile.close();
+}
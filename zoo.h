@@ -14,6 +14,7 @@
 // #include ...
 #include "grid.h"
 #include "world.h"
+#include "state_grid.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -30,6 +31,11 @@ namespace Zoo {
     Grid load_binary(std::string path);
     void save_binary(std::string path, Grid grid);
 
+    StateGrid load_ascii_states(std::string path);
+    void save_ascii_states(std::string path, StateGrid grid);
+    StateGrid load_binary_states(std::string path);
+    void save_binary_states(std::string path, StateGrid grid);
+
     Grid glider();
     Grid r_pentomino();
     Grid light_weight_spaceship();